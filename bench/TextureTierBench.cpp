@@ -0,0 +1,43 @@
+#include "../include/GUI/AssetManager.h"
+#include "../include/GUI/CardRender.h"
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+// gwent_texture_bench: loads the card art once per texture tier and prints
+// what each tier costs in texture memory. Run it from the build directory,
+// where the assets are copied.
+int main() {
+    sf::RenderWindow window(sf::VideoMode(320, 240), "Texture tiers", sf::Style::None);
+    window.setVisible(false);
+
+    sf::Font font;
+    if (!font.loadFromFile("assets/fonts/times.ttf")) {
+        std::cerr << "Exception: Font load failed" << std::endl;
+        return 1;
+    }
+
+    const std::pair<TextureTier, const char*> tiers[] = {
+        {TextureTier::FULL, "full"},
+        {TextureTier::HIGH, "high"},
+        {TextureTier::STANDARD, "standard"}
+    };
+
+    for (const auto& [tier, name] : tiers) {
+        AssetManager assets;
+        CardRenderer renderer(font, window, assets);
+        renderer.setTextureTier(tier);
+
+        const auto started = std::chrono::steady_clock::now();
+        const bool loaded = renderer.loadResources();
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+
+        const sf::Texture& atlas = renderer.getAtlasTexture();
+        const sf::Vector2u size = atlas.getSize();
+        std::cerr << name << ": atlas " << size.x << "x" << size.y << ", "
+                  << AssetManager::textureBytes(atlas, true) / 1024 << " KiB with mipmaps; texture memory "
+                  << assets.getTextureMemory() / 1024 << " KiB; loaded in " << ms << " ms"
+                  << (loaded ? "" : " (some art missing)") << "\n";
+    }
+    return 0;
+}
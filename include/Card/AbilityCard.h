@@ -16,6 +16,7 @@ public:
     AbilityEffect getEffect() const { return effect; }
     int getEffectValue() const { return effectValue; }
     sf::FloatRect getGlobalBounds() const;
+    std::unique_ptr<Card> clone() const override;
 
 
 private:
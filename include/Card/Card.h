@@ -4,6 +4,8 @@
 #include "../Utils/enums.h"
 #include <string>
 #include <memory>
+#include <cstdint>
+#include <iosfwd>
 
 class Player;
 class Board;
@@ -16,6 +18,9 @@ protected:
     CombatZone zone;
     Faction faction;
     std::string description;
+    std::uint32_t stateVersion;
+
+    void touch();
 
 public:    
     Card(const std::string& name, int power, CardType type, CombatZone zone, 
@@ -25,6 +30,8 @@ public:
     virtual void applyEffect(Player& owner, Player& opponent, Board& board) = 0;
 
     virtual sf::FloatRect getGlobalBounds() const = 0;
+    // A fresh copy in the card's current state, for building decks from a pool.
+    virtual std::unique_ptr<Card> clone() const = 0;
     const std::string& getName() const;
     int getPower() const;
     void setPower(int newPower);
@@ -32,8 +39,10 @@ public:
     CombatZone getZone() const;
     Faction getFaction() const;
     const std::string& getDescription() const;
-    virtual void takeDamage(int amount);
+    // Reports a destroyed card to out unless it is nullptr.
+    virtual void takeDamage(int amount, std::ostream* out);
     virtual WeatherType getWeatherType() const;
+    std::uint32_t getStateVersion() const;
     
     sf::Vector2f position;
     sf::Vector2f size;
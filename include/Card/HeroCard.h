@@ -22,4 +22,5 @@ public:
     HeroAbility getAbility() const;
     int getAbilityValue() const;
     sf::FloatRect getGlobalBounds() const;
+    std::unique_ptr<Card> clone() const override;
 };
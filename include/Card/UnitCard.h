@@ -3,6 +3,7 @@
 #include <SFML/Graphics.hpp>
 #include "../Card/Card.h"
 #include "../Utils/enums.h"
+#include <random>
 
 class UnitCard : public Card {
 private:
@@ -19,8 +20,9 @@ public:
              int effectValue = 0, bool isSpy = false);
     void play(Player& owner, Player& opponent, Board& board) override;
     void applyEffect(Player& owner, Player& opponent, Board& board) override;
-    void triggerDeployEffect(Player& owner, Player& opponent, Board& board);
+    void triggerDeployEffect(Player& owner, Player& opponent, Board& board, std::mt19937& rng);
     sf::FloatRect getGlobalBounds() const;
+    std::unique_ptr<Card> clone() const override;
 
     int getBasePower() const;
     bool isHeroCard() const;
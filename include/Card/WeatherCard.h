@@ -21,5 +21,6 @@ public:
     WeatherType getWeatherType() const override;
     int getEffectValue() const;
     sf::FloatRect getGlobalBounds() const;
+    std::unique_ptr<Card> clone() const override;
     static std::string weatherEffectDescription(WeatherType type);
 };
@@ -6,6 +6,9 @@
 #include <memory>
 #include <map>
 #include <array>
+#include <cstdint>
+#include <iostream>
+#include <random>
 
 struct ScorchResult {
     std::string destroyedName;
@@ -16,16 +19,19 @@ struct ScorchResult {
 
 class Board {
 private:
-    static Board* instance;
     struct PlayerBoard {
         std::map<CombatZone, std::vector<std::unique_ptr<Card>>> zones;
         std::vector<std::unique_ptr<Card>> graveyard;
     };
     std::array<PlayerBoard, 2> playerBoards;
     std::vector<std::unique_ptr<Card>> weatherEffects;
+    // Every rule that picks at random draws from here, so a game replays
+    // from Game::setSeed alone.
+    std::mt19937 rng;
+    // Where the rules narrate the game; cards played here write to it too.
+    std::ostream* output = &std::cout;
 
 public:
-    static Board* getInstance();
     void addCard(int playerIndex, std::unique_ptr<Card> card);
     void cleanupDestroyedUnits(int playerId, CombatZone zone);
     ScorchResult destroyStrongestEnemyUnit(int attackingPlayerId, Card* activatingCard = nullptr);   
@@ -51,6 +57,11 @@ public:
     void damageRow(int playerIndex, CombatZone zone, int damage);
     std::string destroyWeakestUnit(int playerIndex);
     void clearBoard();
+    void seed(std::uint32_t value);
+    std::mt19937& getRng();
+    // nullptr keeps the board quiet.
+    void setOutput(std::ostream* stream);
+    std::ostream* getOutput() const;
     bool hasUnitsInZone(int playerId, CombatZone zone) const;
 
     std::vector<std::unique_ptr<Card>>& getPlayerZone(int playerIndex, CombatZone zone);
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Maps card names from cards.json to small dense ids, used on the wire
+// and in exported analytics.
+class CardCatalog {
+public:
+    void load(const std::string& deckJson);
+
+    std::uint32_t idOf(const std::string& name) const;
+    const std::string& nameOf(std::uint32_t id) const;
+    std::size_t size() const { return names.size(); }
+
+private:
+    std::unordered_map<std::string, std::uint32_t> ids;
+    std::vector<std::string> names;
+};
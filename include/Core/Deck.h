@@ -5,11 +5,18 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <iostream>
+#include <random>
+#include <cstdint>
+#include <functional>
 
 class Deck {
 private:
     std::vector<std::unique_ptr<Card>> cards;
     std::vector<std::unique_ptr<Card>> graveyard;
+    std::mt19937 rng{std::random_device{}()};
+    Faction faction = Faction::NEUTRAL;
+    std::ostream* output = &std::cout;
     
     DeployEffect stringToDeployEffect(const std::string& str);
     HeroAbility stringToHeroAbility(const std::string& str);
@@ -22,11 +29,22 @@ public:
     Deck() = default;
     
     void loadFromJson(const std::string& filename);
+    void loadFromJson(std::istream& input);
+    // Makes every later shuffle reproducible from this seed.
+    void seed(std::uint32_t value);
     void shuffle();
+    // Where shuffles are reported; nullptr keeps the deck quiet.
+    void setOutput(std::ostream* stream);
     std::unique_ptr<Card> drawCard();
     void addCard(std::unique_ptr<Card> card);
     void addToGraveyard(std::unique_ptr<Card> card);
     size_t size() const;
+    const std::vector<std::unique_ptr<Card>>& getCards() const;
+    // Drops every card keep() rejects; the graveyard is left alone.
+    void filter(const std::function<bool(const Card&)>& keep);
+    // NEUTRAL for a deck not tied to one faction.
+    Faction getFaction() const;
+    void setFaction(Faction value);
     size_t graveyardSize() const;
     void reshuffleGraveyard();
     CombatZone getDefaultZoneForWeather(WeatherType type) const;
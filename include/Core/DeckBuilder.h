@@ -1,10 +1,18 @@
 #pragma once
 #include "Deck.h"
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 class DeckBuilder {
 private:
     std::unique_ptr<Deck> deck;
+    Faction faction = Faction::NEUTRAL;
+    size_t minCards = 0;
+    size_t maxCards = std::numeric_limits<size_t>::max();
 
 public:
     DeckBuilder() : deck(std::make_unique<Deck>()) {}
@@ -19,17 +27,69 @@ public:
         return *this;
     }
 
+    // Adds a copy of pool card i for every i in picks, leaving the pool intact.
+    DeckBuilder& addCopies(const Deck& pool, const std::vector<std::uint32_t>& picks) {
+        const auto& cards = pool.getCards();
+        for (std::uint32_t index : picks) {
+            if (index >= cards.size()) {
+                throw std::out_of_range("Card index outside the pool");
+            }
+            deck->addCard(cards[index]->clone());
+        }
+        return *this;
+    }
+
+    // Adds a copy of every card in the pool.
+    DeckBuilder& addCopies(const Deck& pool) {
+        for (const auto& card : pool.getCards()) {
+            deck->addCard(card->clone());
+        }
+        return *this;
+    }
+
     DeckBuilder& addCardToGraveyard(std::unique_ptr<Card> card) {
         deck->addToGraveyard(std::move(card));
         return *this;
     }
 
+    // build() keeps only cards of this faction and neutral ones.
+    // NEUTRAL, the default, keeps every card.
+    DeckBuilder& forFaction(Faction value) {
+        faction = value;
+        return *this;
+    }
+
+    // build() throws unless the deck ends up within these bounds.
+    DeckBuilder& minSize(size_t count) {
+        minCards = count;
+        return *this;
+    }
+
+    DeckBuilder& maxSize(size_t count) {
+        maxCards = count;
+        return *this;
+    }
+
     DeckBuilder& shuffle() {
         deck->shuffle();
         return *this;
     }
 
     std::unique_ptr<Deck> build() {
+        if (faction != Faction::NEUTRAL) {
+            deck->filter([this](const Card& card) {
+                return card.getFaction() == faction || card.getFaction() == Faction::NEUTRAL;
+            });
+        }
+        deck->setFaction(faction);
+        if (deck->size() < minCards) {
+            throw std::runtime_error("Deck has " + std::to_string(deck->size()) + " cards, needs at least " +
+                                     std::to_string(minCards));
+        }
+        if (deck->size() > maxCards) {
+            throw std::runtime_error("Deck has " + std::to_string(deck->size()) + " cards, allows at most " +
+                                     std::to_string(maxCards));
+        }
         return std::move(deck);
     }
 };
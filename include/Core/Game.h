@@ -5,13 +5,20 @@
 #include "../Core/Deck.h"
 #include <string>
 #include <array>
+#include <cstdint>
+#include <iostream>
+#include <memory>
 
 class Game {
+public:
+    static constexpr int OPENING_HAND = 10;
+    static constexpr std::size_t MIN_DECK_SIZE = 22;
+    static constexpr std::size_t MAX_DECK_SIZE = 40; // for faction decks
+
 private:
     Board board;
     std::array<Player, 2> players;
     std::array<bool, 2> playerPassed;
-    Deck deck;
     int currentRound = 1;
     bool gameOver = false;
     mutable bool newRoundFlag = false;
@@ -19,6 +26,10 @@ private:
     std::array<bool, 2> passedPlayers{false, false};
     int currentPlayerIndex = 0;
     bool abilityUsedThisRound = false;
+    std::uint64_t stateVersion = 0;
+    std::uint32_t seed;
+    std::vector<std::array<int, 2>> roundScores;
+    std::ostream* output = &std::cout;
 
 public:
     Player& getOpponent();
@@ -32,7 +43,20 @@ public:
     std::string getWinnerName() const;
     int getCurrentPlayerIndex() const;
     void update(float deltaTime);
-    void loadDeck(const std::string& filename);
+    // Each player gets their own copy of the card file, cut down to their
+    // faction plus neutral cards; NEUTRAL keeps the whole file.
+    void loadDeck(const std::string& filename, Faction first = Faction::NEUTRAL,
+                  Faction second = Faction::NEUTRAL);
+    void loadDeck(std::istream& input, Faction first = Faction::NEUTRAL,
+                  Faction second = Faction::NEUTRAL);
+    void setPlayerDecks(std::unique_ptr<Deck> first, std::unique_ptr<Deck> second);
+    static std::unique_ptr<Deck> buildDeck(const Deck& pool, Faction faction);
+    // Must be called before startGame() to take effect.
+    void setSeed(std::uint32_t value);
+    // Where the rules narrate the game: the board, both players and their
+    // decks write here. nullptr keeps the whole game quiet.
+    void setOutput(std::ostream* stream);
+    std::uint32_t getSeed() const;
     void startGame();
     void nextRound();
     void playCard(int playerIndex, int cardIndex);
@@ -40,9 +64,12 @@ public:
     bool isPlayerTurn(int playerIndex) const;
 
     void calculateRoundWinner();
+    const std::vector<std::array<int, 2>>& getRoundScores() const;
     void printGameState() const;
     void resetPassStates();
     bool haveBothPlayersPassed() const;
+    bool hasPassed(int playerIndex) const;
+    int getCurrentRound() const;
     
     bool isGameOver() const;
     const Player& getCurrentPlayer() const;
@@ -51,4 +78,7 @@ public:
     Player& getPlayer(int index);
     const Board& getBoard() const;
     Board& getBoard();
+
+    std::uint64_t getStateVersion() const;
+    void markStateChanged();
 };
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "GameSnapshot.h"
+#include "../Utils/TripleBuffer.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Game;
+
+struct GameCommand {
+    // CLICK_CARD plays the card if it is already selected and selects it
+    // otherwise, decided against the live game rather than a snapshot.
+    enum class Type { SELECT_CARD, DESELECT_CARD, PLAY_CARD, CLICK_CARD, PASS, END_TURN, ACTIVATE_HERO };
+
+    Type type;
+    int playerId = 0;
+    int index = -1;
+    CombatZone zone = CombatZone::CLOSE;
+};
+
+// Runs the rules engine on its own thread. The GUI posts commands and reads
+// back immutable GameSnapshots through a triple buffer, so a slow rule or
+// effect never holds up a frame.
+class GameLogicThread {
+public:
+    explicit GameLogicThread(std::unique_ptr<Game> game);
+    ~GameLogicThread();
+
+    GameLogicThread(const GameLogicThread&) = delete;
+    GameLogicThread& operator=(const GameLogicThread&) = delete;
+
+    void start();
+    void stop();
+    void post(const GameCommand& command);
+
+    // Render thread: switch to the newest snapshot if one was published.
+    bool acquireSnapshot();
+    const GameSnapshot& snapshot() const;
+    bool hasPendingCommands() const;
+
+private:
+    std::unique_ptr<Game> game;
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<GameCommand> queue;
+    bool stopping = false;
+    std::atomic<std::uint64_t> postedCommands{0};
+
+    TripleBuffer<GameSnapshot> snapshots;
+    std::uint64_t sequence = 0;
+    std::uint64_t processedCommands = 0;
+    std::uint32_t messageId = 0;
+    std::string message;
+
+    void run();
+    void execute(const GameCommand& command);
+    void publish();
+};
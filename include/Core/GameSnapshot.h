@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../Utils/enums.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Card;
+class Game;
+
+// Plain copy of everything the GUI needs to draw one card, so the renderer
+// never touches Card objects owned by the logic thread.
+struct CardView {
+    const void* identity = nullptr;
+    std::uint32_t version = 0;
+    std::string name;
+    CardType type = CardType::UNIT;
+    CombatZone zone = CombatZone::CLOSE;
+    Faction faction = Faction::NEUTRAL;
+    WeatherType weather = WeatherType::NONE;
+    int power = 0;
+    std::string tooltip;
+};
+
+struct PlayerView {
+    int id = 0;
+    std::string name;
+    int roundsWon = 0;
+    int selectedIndex = -1;
+    std::vector<CardView> hand;
+    std::array<std::vector<CardView>, 3> zones;
+    std::array<int, 3> zonePower{};
+};
+
+// Immutable state of one game at one point in time, published by the logic
+// thread and read by the render thread.
+struct GameSnapshot {
+    std::uint64_t sequence = 0;
+    std::uint64_t processedCommands = 0;
+    int currentPlayer = 0;
+    bool gameOver = false;
+    std::string winnerName;
+    std::array<PlayerView, 2> players;
+
+    std::uint32_t messageId = 0;
+    std::string message;
+
+    const PlayerView& current() const { return players[currentPlayer]; }
+    const PlayerView& opponent() const { return players[1 - currentPlayer]; }
+
+    // Overwrites every field but keeps vector capacity from earlier captures.
+    void capture(const Game& game);
+};
+
+std::string describeCard(const Card& card);
@@ -1,15 +1,14 @@
 #pragma once
 
 #include "../Card/Card.h"
+#include "../Core/Deck.h"
 #include <vector>
 #include <memory>
 #include <unordered_set>
 #include <string>
+#include <iostream>
 
 class Board;
-class Deck;
-class Game;
-class GameWindow;
 class Hero {
     public:
         std::vector<HeroAbility> abilities;
@@ -24,21 +23,17 @@ private:
     std::vector<std::unique_ptr<Card>> graveyard;
     int roundsWon;
     int playerId;
-    Deck* deck;
+    std::unique_ptr<Deck> deck;
     int selectedCardIndex = -1;
-    GameWindow* gameWindow = nullptr;
     Hero hero;
     Player* opponent = nullptr;
-    Game* game = nullptr;
+    std::ostream* output = &std::cout;
 
 public:
     Player(const std::string& name, int id, int startingLifepoints = 2);
     void setOpponent(Player* opp);
-    void setGameReference(Game* gameRef);
     Player& getOpponent() const;
-    
-    void setGameWindow(GameWindow* window);
-    GameWindow* getGameWindow() const;
+
     const Hero& getHero() const;
     const std::vector<HeroAbility>& getHeroAbilities() const;
     std::vector<HeroAbility>& getHeroAbilities();
@@ -71,7 +66,12 @@ public:
 
     
 
-    void setDeck(Deck* d);    
+    // The deck, current and future, reports to the same stream; nullptr
+    // keeps the player quiet.
+    void setOutput(std::ostream* stream);
+    void setDeck(std::unique_ptr<Deck> d);
+    Deck* getDeck();
+    const Deck* getDeck() const;    
     const std::string& getName() const;
     int getLifepoints() const;
     size_t getHandSize() const;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Decodes image files into sf::Image on a pool of worker threads.
+// Requests are collected first, then start() spreads them over the workers;
+// textures are created from the results on the render thread afterwards.
+class AssetLoader {
+public:
+    explicit AssetLoader(unsigned workerCount = std::thread::hardware_concurrency());
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Repeated requests for the same path share one decode.
+    std::size_t request(const std::string& path);
+    // Images larger than this are downscaled on the worker, keeping their
+    // aspect ratio. A zero size disables downscaling.
+    void setMaxImageSize(const sf::Vector2u& size);
+    void start();
+    void wait();
+
+    bool isDone() const;
+    float getProgress() const;
+
+    // Only valid once isDone() returns true; nullptr if decoding failed.
+    const sf::Image* getImage(std::size_t handle) const;
+    const std::string& getPath(std::size_t handle) const;
+
+    static sf::Image downscale(const sf::Image& source, const sf::Vector2u& maxSize);
+
+private:
+    struct Job {
+        std::string path;
+        sf::Image image;
+        bool loaded = false;
+    };
+
+    unsigned workerCount;
+    std::vector<Job> jobs;
+    std::unordered_map<std::string, std::size_t> handlesByPath;
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> nextJob{0};
+    std::atomic<std::size_t> finishedJobs{0};
+    bool started = false;
+    sf::Vector2u maxImageSize;
+
+    void workerLoop();
+};
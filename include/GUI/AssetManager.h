@@ -0,0 +1,83 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+class AssetManager;
+
+struct TextureEntry {
+    AssetManager* owner = nullptr;
+    std::string path;
+    sf::Texture texture;
+    std::size_t bytes = 0;
+    std::uint64_t lastUse = 0;
+    bool smooth = true;
+    bool mipmapped = false;
+    bool loaded = false;
+    bool failed = false;
+};
+
+// Shared, reference-counted handle to a texture owned by an AssetManager.
+// The file is only read the first time get() is called.
+class TextureHandle {
+public:
+    TextureHandle() = default;
+
+    const sf::Texture& get() const;
+    bool isValid() const;
+    bool isLoaded() const;
+    const std::string& getPath() const;
+
+private:
+    friend class AssetManager;
+    explicit TextureHandle(std::shared_ptr<TextureEntry> entry);
+
+    std::shared_ptr<TextureEntry> entry;
+};
+
+// Central texture cache: entries are keyed by normalized path so every caller
+// of the same file shares one texture, and loaded textures are counted against
+// a memory budget. Textures no handle refers to are the first to be evicted.
+class AssetManager {
+public:
+    static constexpr std::size_t DEFAULT_BUDGET = 256u * 1024u * 1024u;
+
+    explicit AssetManager(std::size_t budgetBytes = DEFAULT_BUDGET);
+    ~AssetManager();
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    TextureHandle texture(const std::string& path, bool smooth = true);
+
+    // Accounts for textures owned elsewhere (e.g. the card atlas).
+    void trackExternal(const std::string& name, const sf::Texture& texture, bool mipmapped = false);
+
+    std::size_t collectUnused();
+    void setBudget(std::size_t budgetBytes);
+    std::size_t getBudget() const;
+    std::size_t getTextureMemory() const;
+    std::size_t getLoadedCount() const;
+    void printReport(std::ostream& out) const;
+
+    static std::size_t textureBytes(const sf::Texture& texture, bool mipmapped);
+
+private:
+    friend class TextureHandle;
+
+    std::unordered_map<std::string, std::shared_ptr<TextureEntry>> entries;
+    std::map<std::string, std::size_t> external;
+    std::size_t budget;
+    std::size_t loadedBytes = 0;
+    std::uint64_t useClock = 0;
+
+    void ensureLoaded(TextureEntry& entry);
+    void unload(TextureEntry& entry);
+    void enforceBudget(const TextureEntry* keep);
+};
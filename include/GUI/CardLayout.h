@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "../Core/GameSnapshot.h"
+
+class CardLayout {
+public:
+    struct Slot {
+        const CardView* card;
+        sf::FloatRect bounds;
+        int playerId;
+        CombatZone zone;
+        int index;
+        bool inHand;
+    };
+
+    CardLayout(const sf::Vector2f& cardSize, float spacing);
+
+    bool needsRebuild(const GameSnapshot& state, const sf::Vector2u& windowSize) const;
+    void rebuild(const GameSnapshot& state, const sf::Vector2u& windowSize);
+    void invalidate();
+
+    const Slot* hitTest(const sf::Vector2f& point) const;
+    const std::vector<Slot>& getSlots() const;
+
+    sf::FloatRect handCardRect(size_t handSize, size_t index) const;
+    sf::FloatRect zoneCardRect(int playerId, int zoneIndex, size_t index) const;
+    float zoneTop(int zoneIndex) const;
+    float zoneHeight() const;
+
+private:
+    // One bucket per laid-out row; cards in a row share top, height and
+    // stride, so the column under a point is found arithmetically.
+    struct Row {
+        float top;
+        float left;
+        float right;
+        size_t first;
+        size_t count;
+    };
+
+    sf::Vector2f cardSize;
+    float spacing;
+    sf::Vector2u windowSize;
+    std::uint64_t builtVersion = 0;
+    bool built = false;
+
+    std::vector<Slot> slots;
+    std::vector<Row> rows;
+
+    void addRow(float left, float top, int playerId, CombatZone zone, bool inHand,
+                const std::vector<CardView>& cards);
+};
@@ -8,12 +8,11 @@
 #include <vector>
 #include <iostream>
 #include <map>
-#include "../Card/Card.h"
-#include "../Card/UnitCard.h"
-#include "../Card/HeroCard.h"
+#include "../Core/GameSnapshot.h"
 #include "../GUI/Tooltip.h"
-#include "../Card/AbilityCard.h"
-#include "../Card/WeatherCard.h"
+#include "../GUI/TextureAtlas.h"
+#include "../GUI/AssetLoader.h"
+#include "../GUI/AssetManager.h"
 #include "../include/Utils/CardUtils.h"
 
 static std::string zoneName(CombatZone z) {
@@ -54,32 +53,66 @@ struct TripleKey {
     }
 };
 
+// Card art is downscaled at load time to fit a multiple of CARD_SIZE.
+enum class TextureTier { FULL, HIGH, STANDARD };
+
+enum class BakedShape { SHADOW, FRAME, GLOW };
+
+struct ShapeKey {
+    BakedShape shape;
+    int width;
+    int height;
+    int param;
+
+    bool operator<(const ShapeKey& other) const {
+        return std::tie(shape, width, height, param) < std::tie(other.shape, other.width, other.height, other.param);
+    }
+};
+
 
 class CardRenderer {
 public:
-    explicit CardRenderer(sf::Font& font, sf::RenderWindow& window);
+    CardRenderer(const sf::Font& font, sf::RenderWindow& window, AssetManager& assets);
     bool loadResources();
-    void renderCard(sf::RenderTarget& target, const Card& card, float x, float y, bool highlight = false, bool isCurrentPlayer = false);
-    void updateHover(const sf::Vector2f& mousePos, const std::vector<const Card*>& cards);
+    void queueResources(AssetLoader& loader);
+    bool finishLoading(const AssetLoader& loader);
+    void setTextureTier(TextureTier tier);
+    static TextureTier parseTextureTier(const std::string& name);
+    void renderCard(sf::RenderTarget& target, const CardView& card, float x, float y, bool highlight = false, bool isCurrentPlayer = false);
+    void updateHover(const sf::Vector2f& mousePos, const CardView* card);
     void drawTooltip(sf::RenderTarget& target) const;
-    std::string generateTooltipText(const Card& card) const;
     sf::Vector2f getCardSize() const;
     void renderCardBack(sf::RenderTarget& target, float x, float y);
-    void setupCardBase(sf::RectangleShape& cardBase, const Card& card) const;
+    void setupCardBase(sf::RectangleShape& cardBase, const CardView& card) const;
+
+    void beginBatch();
+    void flushBatch(sf::RenderTarget& target);
+    void endBatch(sf::VertexArray& out);
+    const sf::Texture& getAtlasTexture() const;
 
     static const sf::Vector2f CARD_SIZE;
     static constexpr float CARD_CORNER_RADIUS = 10.f;
     static constexpr float CARD_ELEVATION = 5.f;
+    static constexpr float SHADOW_SOFTNESS = 4.f;
+    static constexpr float GLOW_RADIUS = 25.f;
     
     
 private:
     
 
     Tooltip tooltip;
-    sf::Font font;
-    sf::Texture cardBackTexture;
-    sf::Texture cardBaseTexture;
-    std::map<TripleKey, sf::Texture> textures;
+    const sf::Font& font;
+    AssetManager& assets;
+    TextureAtlas atlas;
+    std::map<TripleKey, sf::IntRect> textureRegions;
+    sf::IntRect cardBackRegion;
+    std::map<TripleKey, std::size_t> pendingImages;
+    std::size_t pendingCardBack = 0;
+    TextureTier textureTier = TextureTier::HIGH;
+    std::map<ShapeKey, sf::IntRect> shapeRegions;
+
+    sf::VertexArray batch{sf::Triangles};
+    bool batching = false;
 
     
     std::unordered_map<Faction, sf::Color> factionColors;
@@ -87,10 +120,8 @@ private:
     std::unordered_map<WeatherType, sf::Color> weatherColors;
     
     sf::Clock hoverClock;
-    const Card* hoveredCard = nullptr;
+    const CardView* hoveredCard = nullptr;
     sf::Clock pulseClock;
-    sf::Texture cardGlowTexture;
-    std::map<Faction, sf::Texture> factionTextures;
 
     void renderCardHoverEffect(sf::RenderTarget& target, float x, float y) const;
     void renderRoundedRectangle(sf::RenderTarget& target, const sf::FloatRect& rect, 
@@ -102,4 +133,20 @@ private:
     void setupCardText(sf::Text& text, const std::string& str, unsigned size, 
                      float x, float y, const sf::Color& color = sf::Color::White, bool bold = false) const;
     void renderCardGlow(sf::RenderTarget& target, float x, float y, const sf::Color& color) const;
+
+    TripleKey textureKeyFor(const CardView& card) const;
+    void appendQuad(sf::VertexArray& vertices, const sf::FloatRect& rect,
+                    const sf::IntRect& texRect, const sf::Color& color) const;
+    void appendFrame(sf::VertexArray& vertices, const sf::FloatRect& rect,
+                     float thickness, const sf::Color& color) const;
+    void appendCircle(sf::VertexArray& vertices, const sf::Vector2f& center, float radius,
+                      int points, const sf::Color& color) const;
+    void appendRoundedRectangle(sf::VertexArray& vertices, const sf::FloatRect& rect,
+                                float radius, const sf::Color& color) const;
+
+    void bakeShapes(std::map<ShapeKey, std::size_t>& handles);
+    void appendShadow(sf::VertexArray& vertices, const sf::FloatRect& rect, const sf::Color& color) const;
+    void appendCardFrame(sf::VertexArray& vertices, const sf::FloatRect& face,
+                         float thickness, const sf::Color& color) const;
+    void appendGlow(sf::VertexArray& vertices, const sf::Vector2f& center, const sf::Color& color) const;
 };
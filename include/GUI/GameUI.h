@@ -4,13 +4,14 @@
 #include <vector>
 #include <functional>
 #include <memory>
-#include "Core/Game.h"
+#include "Core/GameLogicThread.h"
 #include "GUI/CardRender.h"
 #include "GUI/Button.h"
+#include "GUI/CardLayout.h"
 
 class GameUI {
 public:
-    GameUI(Game& game, CardRenderer& renderer, const sf::Font& font);
+    GameUI(GameLogicThread& logic, CardRenderer& renderer, const CardLayout& layout, const sf::Font& font);
     GameUI(const GameUI&) = delete;
     GameUI& operator=(const GameUI&) = delete;
     
@@ -19,31 +20,29 @@ public:
     ~GameUI() = default;
 
     void handleEvent(const sf::Event& event, const sf::RenderWindow& window);
-    void update(const sf::RenderWindow& window);
+    void update(const sf::RenderWindow& window, float deltaTime);
+    bool isAnimating() const;
     void render(sf::RenderWindow& window);
     
     void showMessage(const std::string& message, float duration = 3.0f);
 
 private:
-    Game& game;
+    GameLogicThread& logic;
     CardRenderer& cardRenderer;
+    const CardLayout& cardLayout;
     const sf::Font& font;
     
     std::vector<Button> buttons;
     sf::Text messageText;
     sf::RectangleShape messageBackground;
     float messageTimer = 0.0f;
-    sf::Texture northBannerTexture;
-    sf::Texture nilfgaardBannerTexture;
-    sf::Texture scoiatelBannerTexture;
-    sf::Texture monstersBannerTexture;
     
     void onPassClicked();
     void onEndTurnClicked();
     void onHelpClicked();
     
-    bool isCardClicked(const sf::Vector2f& mousePos, const Player& player, 
+    bool isCardClicked(const sf::Vector2f& mousePos, const PlayerView& player, 
         int& clickedIndex, const sf::RenderWindow& window) const;
 
-    void renderSelectedCardHighlight(sf::RenderWindow& window, const Player& player) const;
+    void renderSelectedCardHighlight(sf::RenderWindow& window, const PlayerView& player) const;
 };
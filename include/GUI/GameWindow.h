@@ -3,14 +3,18 @@
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <string>
-#include "Core/Game.h"
+#include "Core/GameLogicThread.h"
 #include "Tooltip.h"
 #include "CardRender.h"
 #include "GameUI.h"
 #include "DropdownMenu.h"
 #include "HelpPanel.h"
+#include "CardLayout.h"
+#include "RetainedScene.h"
+#include "TextCache.h"
+#include "ProfilerOverlay.h"
+#include "AssetManager.h"
 
-class Game;
 class CardRenderer;
 class GameWindow {
 public:
@@ -20,24 +24,29 @@ public:
     bool isWindowValid() const;
 
 private:
-    sf::FloatRect getHandCardPosition(const Player& player, int index) const;
+    sf::FloatRect getHandCardPosition(const PlayerView& player, int index) const;
     void renderGameOverMessage();
+    void renderLoadingScreen(float progress);
     sf::Clock gameOverClock;
     bool gameOverTriggered = false;
     
     int currentPlayerIndex;
+    CardLayout cardLayout;
     void processEvents();
+    void handleEvent(const sf::Event& event);
     void update(float deltaTime);
     void render();
     void loadResources();
-    std::vector<const Card*> getAllVisibleCards() const;
+    void refreshLayout();
+    void acquireState();
+    const GameSnapshot& state() const;
 
     void syncPlayerIndex(); 
     void renderGameBoard();
-    void renderPlayerHand(const Player& player, bool isCurrentPlayer);
+    void renderPlayerHand(const PlayerView& player, bool isCurrentPlayer);
     void renderCombatZones();
     void renderPlayerInfo();
-    void renderCardsInZone(const std::vector<std::unique_ptr<Card>>& cards, float x, float y);
+    void renderCardsInZone(const std::vector<CardView>& cards, float x, float y);
     void handleCardSelection(const sf::Vector2f& mousePos);
     struct GameMessage {
         std::string text;
@@ -47,11 +56,13 @@ private:
     };
 
     sf::Font font;
-    sf::Texture backgroundTexture;
+    AssetManager assets;
+    TextureHandle backgroundTexture;
     sf::Sprite background;
 
     sf::RenderWindow window;
-    std::unique_ptr<Game> game;
+    std::unique_ptr<GameLogicThread> logic;
+    std::uint32_t shownMessageId = 0;
     std::unique_ptr<CardRenderer> cardRenderer;
     std::unique_ptr<GameUI> gameUI;
     std::string getWinnerName() const;
@@ -59,7 +70,7 @@ private:
     DropdownMenu mainMenu;
     HelpPanel helpPanel;
 
-    sf::Texture zoneBackgrounds[3];
+    TextureHandle zoneBackgrounds[3];
     sf::RectangleShape zoneDividers[3];
     sf::Text zonePowerTexts[3][2];
     sf::Text messageText;
@@ -73,6 +84,35 @@ private:
     sf::Clock gameClock;
     sf::Text turnText;
 
+    RetainedScene scene;
+    TextCache textCache;
+    std::uint64_t sceneVersion = 0;
+    int sceneSelectedIndex = -1;
+    sf::Vector2u sceneSize;
+    bool sceneBuilt = false;
+    unsigned sceneRebuilds = 0;
+
+    struct AnimatedCard {
+        const CardView* card;
+        float x;
+        float y;
+    };
+    std::vector<AnimatedCard> animatedCards;
+
+    bool sceneNeedsRebuild() const;
+    bool isAnimating() const;
+    bool eventDriven = true;
+    void rebuildScene();
+
+    sf::Text frameStatsText;
+    bool showFrameStats = false;
+    float frameTimeAccumulator = 0.f;
+    float frameTimeWorst = 0.f;
+    unsigned framesSinceStats = 0;
+    void updateFrameStats(float frameSeconds);
+
+    ProfilerOverlay profilerOverlay;
+
     void renderTurnGlow();
     void showMessage(const std::string& message, float duration = 3.0f);
     void updateUIState();
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+class ProfilerOverlay {
+public:
+    ProfilerOverlay(const sf::Font& font, const sf::Vector2f& position);
+
+    void toggle();
+    bool isVisible() const;
+    void update(float deltaSeconds);
+    void draw(sf::RenderTarget& target) const;
+
+private:
+    static constexpr float WIDTH = 360.f;
+    static constexpr float GRAPH_HEIGHT = 80.f;
+    static constexpr float GRAPH_MAX_MS = 50.f;
+
+    sf::Vector2f position;
+    sf::RectangleShape panel;
+    sf::RectangleShape budgetLine;
+    sf::VertexArray bars{sf::Triangles};
+    sf::Text scopeText;
+    bool visible = false;
+    float refreshTimer = 0.f;
+
+    void rebuild();
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+
+class RetainedScene : public sf::Drawable {
+public:
+    void clear();
+
+    template<typename DrawableType>
+    DrawableType& add(const DrawableType& drawable) {
+        auto copy = std::make_unique<DrawableType>(drawable);
+        DrawableType& ref = *copy;
+        drawables.push_back(std::move(copy));
+        return ref;
+    }
+
+    // References a text owned elsewhere (e.g. a TextCache) instead of copying its glyph vertices.
+    void addText(const sf::Text& text, const sf::Vector2f& position);
+
+    sf::VertexArray& getCardVertices();
+    void setCardTexture(const sf::Texture* texture);
+    size_t getDrawableCount() const;
+
+    bool bake(const sf::Vector2u& size, const sf::Color& clearColor);
+    bool isBaked() const;
+
+private:
+    class PlacedText : public sf::Drawable {
+    public:
+        PlacedText(const sf::Text& text, const sf::Vector2f& position);
+
+    private:
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+        const sf::Text* text;
+        sf::Vector2f position;
+    };
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    std::vector<std::unique_ptr<sf::Drawable>> drawables;
+    sf::VertexArray cardVertices{sf::Triangles};
+    const sf::Texture* cardTexture = nullptr;
+
+    std::unique_ptr<sf::RenderTexture> layer;
+    sf::Sprite layerSprite;
+    bool baked = false;
+
+    void drawContents(sf::RenderTarget& target, sf::RenderStates states) const;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <string>
+#include <string_view>
+
+// Keeps laid-out sf::Text objects alive across frames, keyed on
+// (string, size, style, colour). Lookups by string_view do not allocate.
+class TextCache {
+public:
+    explicit TextCache(const sf::Font& font);
+
+    const sf::Text& get(std::string_view text, unsigned size,
+                        sf::Uint32 style = sf::Text::Regular,
+                        const sf::Color& color = sf::Color::White);
+
+    // Drops entries not requested since the previous collect().
+    void collect();
+    std::size_t size() const;
+    unsigned getLayoutCount() const;
+
+private:
+    struct Key {
+        std::string text;
+        unsigned size;
+        sf::Uint32 style;
+        sf::Uint32 color;
+    };
+
+    struct KeyView {
+        std::string_view text;
+        unsigned size;
+        sf::Uint32 style;
+        sf::Uint32 color;
+    };
+
+    struct KeyLess {
+        using is_transparent = void;
+
+        static KeyView view(const Key& key) { return {key.text, key.size, key.style, key.color}; }
+        static KeyView view(const KeyView& key) { return key; }
+
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            KeyView left = view(a);
+            KeyView right = view(b);
+            if (left.size != right.size) return left.size < right.size;
+            if (left.style != right.style) return left.style < right.style;
+            if (left.color != right.color) return left.color < right.color;
+            return left.text < right.text;
+        }
+    };
+
+    struct Entry {
+        sf::Text text;
+        unsigned lastUsed;
+    };
+
+    const sf::Font& font;
+    std::map<Key, Entry, KeyLess> entries;
+    unsigned generation = 0;
+    unsigned layoutCount = 0;
+};
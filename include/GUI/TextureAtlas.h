@@ -0,0 +1,35 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+class TextureAtlas {
+public:
+    static constexpr unsigned PADDING = 2;
+    static constexpr unsigned MIPMAP_PADDING = 8;
+    static constexpr unsigned PREFERRED_WIDTH = 4096;
+
+    TextureAtlas();
+
+    std::size_t add(const sf::Image& image);
+    bool build();
+    void clear();
+
+    const sf::Texture& getTexture() const;
+    sf::IntRect getRegion(std::size_t handle) const;
+    sf::IntRect getWhiteRegion() const;
+    bool isBuilt() const;
+
+    void setMipmapped(bool enabled);
+    bool isMipmapped() const;
+
+private:
+    std::vector<sf::Image> pending;
+    std::vector<sf::IntRect> regions;
+    sf::Texture texture;
+    std::size_t whiteHandle;
+    bool built = false;
+    bool mipmapped = false;
+
+    static void extrudeEdges(sf::Image& atlasImage, const sf::IntRect& region, unsigned border);
+};
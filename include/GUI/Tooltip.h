@@ -1,6 +1,8 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
 
 class Tooltip {
 public:
@@ -9,9 +11,24 @@ public:
     void setPosition(float x, float y);
     void draw(sf::RenderTarget& target) const;
     void show(bool visible);
+
+    bool restoreLayout(const void* key, std::uint32_t version);
+    void storeLayout(const void* key, std::uint32_t version);
     
 private:
+    struct CachedLayout {
+        const void* key;
+        std::uint32_t version;
+        sf::Text text;
+        sf::Vector2f size;
+    };
+
     sf::Text text;
     sf::RectangleShape background;
     bool isVisible = false;
+
+    const void* currentKey = nullptr;
+    std::uint32_t currentVersion = 0;
+    std::vector<CachedLayout> layoutCache;
+    static constexpr std::size_t LAYOUT_CACHE_SIZE = 8;
 };
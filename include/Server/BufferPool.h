@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Recycles connection buffers so their capacity survives the connection.
+// Not thread-safe: owned by the reactor thread.
+class BufferPool {
+public:
+    explicit BufferPool(std::size_t maxPooled = 1024, std::size_t maxCapacity = 64 * 1024)
+        : maxPooled(maxPooled), maxCapacity(maxCapacity) {}
+
+    std::string acquire() {
+        if (free.empty()) {
+            std::string buffer;
+            buffer.reserve(INITIAL_CAPACITY);
+            return buffer;
+        }
+        std::string buffer = std::move(free.back());
+        free.pop_back();
+        return buffer;
+    }
+
+    // Oversized buffers are dropped so one burst cannot pin memory forever.
+    void release(std::string&& buffer) {
+        if (free.size() >= maxPooled || buffer.capacity() > maxCapacity) return;
+        buffer.clear();
+        free.push_back(std::move(buffer));
+    }
+
+    std::size_t pooled() const { return free.size(); }
+
+private:
+    static constexpr std::size_t INITIAL_CAPACITY = 512;
+
+    std::vector<std::string> free;
+    std::size_t maxPooled;
+    std::size_t maxCapacity;
+};
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Protocol.h"
+#include "../Core/CardCatalog.h"
+#include "../Utils/enums.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Card;
+class Game;
+
+// What a client last saw of one match. diff() emits the deltas that turn
+// that view into the game's current state and then adopts the new state,
+// so each mutation is sent exactly once no matter which rule caused it.
+// Hands are described by their size, the same as the face-down opponent
+// hand in GameWindow::renderPlayerHand. A shadow made for one seat also
+// sends that seat's own hand card by card; one made for nobody carries no
+// hidden information and is safe to show spectators.
+class MatchShadow {
+public:
+    static constexpr int NO_SEAT = -1;
+
+    explicit MatchShadow(int seat = NO_SEAT) : seat(seat) {}
+
+    void diff(const Game& game, const CardCatalog& catalog, std::vector<Protocol::Delta>& out);
+
+private:
+    struct Slot {
+        const Card* identity;
+        std::uint32_t card;
+        int power;
+    };
+
+    int seat;
+    std::array<std::array<std::vector<Slot>, 3>, 2> zones;
+    std::vector<Slot> hand;
+    std::array<WeatherType, 3> weather{WeatherType::NONE, WeatherType::NONE, WeatherType::NONE};
+    std::array<int, 2> handSize{0, 0};
+    std::array<int, 2> roundsWon{0, 0};
+    std::array<bool, 2> passed{false, false};
+    int round = 1;
+    int currentPlayer = -1;
+    bool gameOver = false;
+
+    std::vector<Slot> scratch;
+
+    void diffRow(const std::vector<std::unique_ptr<Card>>& cards, std::vector<Slot>& previous,
+                 int player, int zone, bool inHand, const CardCatalog& catalog,
+                 std::vector<Protocol::Delta>& out);
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../Utils/enums.h"
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Everything needed to replay one finished match: the deck order follows
+// from seed, and moves are the accepted plays in order.
+struct MatchRecord {
+    struct Move {
+        std::uint8_t player = 0;
+        bool pass = false;
+        std::uint32_t card = 0; // hand index, unused for a pass
+    };
+
+    std::uint64_t matchId = 0;
+    std::uint64_t finishedAt = 0; // unix seconds
+    std::uint32_t seed = 0;
+    std::array<std::string, 2> players;
+    std::array<Faction, 2> factions{Faction::NEUTRAL, Faction::NEUTRAL};
+    std::vector<std::array<int, 2>> roundScores;
+    std::vector<Move> moves;
+};
+
+// Append-only store of finished matches in numbered segment files.
+//
+// Each record is a fixed 32-byte header (magic, version, payload length,
+// checksum, match id, finish time) followed by a varint payload. Callers
+// encode on their own thread; one writer thread appends whatever has
+// queued up with a single write and one fdatasync, so the sync cost is
+// shared by every record in the batch. A torn record at the end of the last
+// segment is cut off when the store is reopened.
+//
+// The index by match id and by player name lives in memory and is rebuilt
+// from the segments on open.
+class MatchHistory {
+public:
+    // A read-only store never writes, truncates or starts the writer thread.
+    explicit MatchHistory(const std::string& directory, bool readOnly = false);
+    ~MatchHistory();
+
+    MatchHistory(const MatchHistory&) = delete;
+    MatchHistory& operator=(const MatchHistory&) = delete;
+
+    // Thread-safe. Blocks only when the writer is far behind.
+    void append(const MatchRecord& record);
+    // Blocks until everything appended so far is synced to disk.
+    void flush();
+
+    bool find(std::uint64_t matchId, MatchRecord& record) const;
+    std::vector<std::uint64_t> findByPlayer(const std::string& name) const;
+
+    std::size_t size() const;
+    std::uint64_t getLastMatchId() const;
+
+private:
+    struct Location {
+        std::size_t segment;
+        std::uint64_t offset;
+        std::uint32_t length;
+    };
+
+    // A queued record and the names it must be indexed under once written.
+    struct Pending {
+        std::uint64_t matchId;
+        std::uint64_t offset; // within the batch
+        std::uint32_t length;
+        std::array<std::string, 2> players;
+    };
+
+    const std::string directory;
+    const bool readOnly;
+
+    mutable std::mutex indexMutex;
+    std::vector<int> segments;
+    std::uint32_t nextSegmentNumber = 0;
+    std::uint64_t activeSize = 0;
+    std::unordered_map<std::uint64_t, Location> byMatch;
+    std::unordered_map<std::string, std::vector<std::uint64_t>> byPlayer;
+    std::uint64_t lastMatchId = 0;
+
+    std::mutex queueMutex;
+    std::condition_variable wake;
+    std::condition_variable progress;
+    std::string queued;
+    std::vector<Pending> queuedIndex;
+    std::uint64_t appendedCount = 0;
+    std::uint64_t syncedCount = 0;
+    bool stopping = false;
+    std::thread writer;
+
+    void load();
+    void loadSegment(std::size_t segment, bool last);
+    void openSegment(std::uint32_t number);
+    void index(std::uint64_t matchId, const Location& location,
+               const std::array<std::string, 2>& players);
+    void run();
+};
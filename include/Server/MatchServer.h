@@ -0,0 +1,126 @@
+#pragma once
+
+#include "MatchShard.h"
+#include "BufferPool.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Hosts many independent matches behind a line-based TCP protocol.
+// Each match is pinned to one MatchShard. A single epoll reactor thread
+// owns every client socket: it parses requests, hands them to shards and
+// writes the replies back, so connections never own a thread.
+//
+//   NEW <name1> <name2> [<faction1> <faction2>]
+//                                  -> OK <matchId> <summary>
+//   JOIN <matchId>                 -> OK <summary> | ERR <reason>
+//   PLAY <matchId> <player> <card> -> OK <summary> | ERR <reason>
+//   PASS <matchId> <player>        -> OK <summary> | ERR <reason>
+//   STATE <matchId>                -> OK <summary>
+//   END <matchId>                  -> OK
+//   STATS                          -> OK <liveMatches> <finishedMatches>
+//
+// <summary> is described by describeMatch(). Each player draws from their
+// own deck of that faction's and neutral cards; without factions both get
+// every card. The creating connection holds both seats until another
+// connection JOINs as player 1; moves and END are only accepted from a
+// seat's holder, and a match is ended when any of its seat holders
+// disconnects. A connection whose first byte
+// is Protocol::MAGIC speaks the binary protocol instead. Replies always
+// come back in request order, even when requests went to different shards.
+// Binary clients may SPECTATE any match; its public deltas are encoded once
+// by the owning shard and the same buffer is queued on every spectator.
+// With a history directory, every finished match is saved when it is ended.
+class MatchServer {
+public:
+    MatchServer(const std::string& deckFile, unsigned shardCount,
+                const std::string& historyDir = "");
+    ~MatchServer();
+
+    MatchServer(const MatchServer&) = delete;
+    MatchServer& operator=(const MatchServer&) = delete;
+
+    void listen(unsigned short port);
+    // Runs the reactor on the calling thread until stop().
+    void run();
+    // Safe to call from any thread.
+    void stop();
+
+private:
+    enum class Mode { UNKNOWN, TEXT, BINARY };
+
+    struct PendingReply {
+        SharedFrame data;
+        bool ready = false;
+    };
+
+    struct Connection {
+        int fd = -1;
+        std::uint64_t id = 0;
+        Mode mode = Mode::UNKNOWN;
+        std::string input;
+        std::deque<PendingReply> replies;
+        std::uint64_t firstSequence = 0;
+        std::deque<SharedFrame> outbound;
+        std::size_t outboundOffset = 0;
+        std::size_t outboundBytes = 0;
+        std::vector<std::uint64_t> watching;
+        // Matches this connection holds a seat in.
+        std::vector<std::uint64_t> seats;
+        bool watchingWrites = false;
+        bool closing = false;
+    };
+
+    std::string deckJson;
+    CardCatalog catalog;
+    std::unique_ptr<MatchHistory> history;
+    std::vector<std::unique_ptr<MatchShard>> shards;
+    unsigned nextShard = 0;
+
+    int listenFd = -1;
+    int epollFd = -1;
+    int wakeFd = -1;
+    std::atomic<bool> running{false};
+
+    // Reactor thread only.
+    BufferPool buffers;
+    std::unordered_map<std::uint64_t, std::unique_ptr<Connection>> connections;
+    std::uint64_t nextConnectionId = 1;
+    std::vector<std::uint64_t> dirty;
+    std::unordered_map<std::uint64_t, std::vector<std::uint64_t>> spectators;
+    Protocol::Message message;
+
+    // Filled by shard threads, drained by the reactor.
+    std::mutex completedMutex;
+    std::vector<MatchReply> completed;
+    std::vector<MatchReply> draining;
+
+    void acceptClients();
+    void onReadable(Connection& connection);
+    void parseText(Connection& connection);
+    void parseBinary(Connection& connection);
+    void handleLine(Connection& connection, const std::string& line);
+    void handleMessage(Connection& connection, const Protocol::Message& request);
+
+    void submit(Connection& connection, unsigned shard, MatchRequest request);
+    void respond(Connection& connection, std::string data);
+    void respondError(Connection& connection, std::uint64_t matchId, const std::string& reason);
+    void deliver(std::vector<MatchReply>& replies);
+    void drainCompleted();
+    void complete(Connection& connection, std::uint64_t sequence, SharedFrame data);
+    void fanOut(const MatchReply& reply);
+    void enqueue(Connection& connection, const SharedFrame& frame);
+    void unwatchAll(Connection& connection);
+    void leaveAll(Connection& connection);
+    void closeMatch(std::uint64_t connection, std::uint64_t matchId);
+
+    void flushDirty();
+    void flush(Connection& connection);
+    void watchWrites(Connection& connection, bool enable);
+    void closeConnection(Connection& connection);
+};
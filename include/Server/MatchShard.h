@@ -0,0 +1,140 @@
+#pragma once
+
+#include "MatchDelta.h"
+#include "MatchHistory.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class Game;
+
+struct MatchRequest {
+    enum class Type { CREATE, JOIN, PLAY, PASS, STATE, CLOSE, SPECTATE, UNWATCH };
+
+    Type type;
+    std::uint64_t matchId = 0;
+    int playerId = 0;
+    int index = -1;
+    std::string player1;
+    std::string player2;
+    // Deck factions for CREATE; NEUTRAL decks hold every card.
+    std::array<Faction, 2> factions{Faction::NEUTRAL, Faction::NEUTRAL};
+    // Binary requests are answered with Protocol frames, text ones with a line.
+    bool binary = false;
+
+    // Where the answer goes. The shard only compares it with the seat
+    // holders of a match.
+    std::uint64_t connection = 0;
+    std::uint64_t sequence = 0;
+};
+
+// Encoded once and shared by every send queue it is fanned out to.
+using SharedFrame = std::shared_ptr<const std::string>;
+
+struct MatchReply {
+    enum class Kind {
+        REPLY,          // answer to one request
+        SEATED,         // answer to CREATE or JOIN; the connection now holds a seat in matchId
+        WATCH,          // answer to SPECTATE; the connection now follows matchId
+        BROADCAST,      // public deltas for everyone following matchId
+        FINAL_BROADCAST // as BROADCAST, after which matchId no longer exists
+    };
+
+    Kind kind;
+    std::uint64_t connection;
+    std::uint64_t sequence;
+    std::uint64_t matchId;
+    SharedFrame data;
+};
+
+// Receives every reply produced by one batch of requests at once.
+using ReplyHandler = std::function<void(std::vector<MatchReply>& replies)>;
+
+// Owns a disjoint set of matches and the only thread that ever touches them,
+// so Game objects need no locking. Requests arrive through a mailbox and
+// every request except UNWATCH produces exactly one REPLY, SEATED or WATCH.
+// Matches with spectators also produce one BROADCAST per change.
+//
+// The connection that creates a match holds both seats. Another connection
+// may JOIN to take seat 1 before that seat has moved. Only a seat's holder
+// may PLAY or PASS for it, and only a seat holder may CLOSE the match.
+class MatchShard {
+public:
+    // history may be null. Local ids start at firstLocalId so a restarted
+    // server does not reuse ids that are already in the history.
+    MatchShard(unsigned index, unsigned shardCount, const std::string& deckJson,
+               const CardCatalog& catalog, ReplyHandler onReplies,
+               MatchHistory* history = nullptr, std::uint64_t firstLocalId = 0);
+    ~MatchShard();
+
+    MatchShard(const MatchShard&) = delete;
+    MatchShard& operator=(const MatchShard&) = delete;
+
+    void start();
+    void stop();
+    void post(MatchRequest request);
+
+    std::size_t getMatchCount() const { return matchCount.load(std::memory_order_relaxed); }
+    std::uint64_t getFinishedCount() const { return finishedCount.load(std::memory_order_relaxed); }
+
+private:
+    const unsigned index;
+    const unsigned shardCount;
+    const std::string& deckJson;
+    const CardCatalog& catalog;
+    ReplyHandler onReplies;
+    MatchHistory* history;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<MatchRequest> queue;
+    bool stopping = false;
+
+    struct Match {
+        std::unique_ptr<Game> game;
+        // What the client at each seat last saw, its own hand included.
+        std::array<MatchShadow, 2> shadows{MatchShadow(0), MatchShadow(1)};
+        // Shared by all spectators; only kept current while there are any.
+        MatchShadow publicShadow;
+        unsigned spectators = 0;
+        // Connection holding each seat.
+        std::array<std::uint64_t, 2> seats{0, 0};
+        std::array<Faction, 2> factions;
+        std::vector<MatchRecord::Move> moves;
+    };
+
+    // Shard thread only.
+    std::unordered_map<std::uint64_t, Match> matches;
+    std::uint64_t nextLocalId;
+    Protocol::Message frame;
+    std::vector<MatchReply> outgoing;
+    // Set by handle() when the request took a seat.
+    bool seated = false;
+
+    std::atomic<std::size_t> matchCount{0};
+    std::atomic<std::uint64_t> finishedCount{0};
+
+    void run();
+    std::string handle(MatchRequest& request);
+    std::string createMatch(MatchRequest& request);
+    std::string join(const MatchRequest& request, Match& match);
+    std::string spectate(std::uint64_t matchId, Match& match);
+    void archive(std::uint64_t matchId, Match& match);
+    void broadcast(std::uint64_t matchId, Match& match);
+    std::string stateReply(std::uint64_t matchId, int seat, bool binary, Match& match);
+    std::string errorReply(const MatchRequest& request, const std::string& reason);
+    std::string encodeFrame() const;
+};
+
+// One-line summary sent after every move:
+// "<currentPlayer> <gameOver> <hand0> <hand1> <rounds0> <rounds1>"
+std::string describeMatch(const Game& game);
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Compact binary protocol between gwent_server and its clients.
+//
+// Frame:  MAGIC, VERSION, type, varint payload length, payload
+//
+// Clients only send moves, plus JOIN_MATCH to take seat 1 of a match
+// another client created; the server answers every frame with a
+// MATCH_STATE frame holding the deltas since its previous answer to that
+// seat, including the seat's own hand, or an ERROR frame. A SPECTATE request is answered with the full
+// public state, after which every change to that match is pushed as an
+// unsolicited MATCH_STATE frame until MATCH_CLOSED. Integers are LEB128 varints, signed values are
+// zigzag encoded, so a typical delta is 3-5 bytes.
+namespace Protocol {
+    constexpr std::uint8_t MAGIC = 0x9E;
+    constexpr std::uint8_t VERSION = 1;
+    constexpr std::size_t MAX_PAYLOAD = 64 * 1024;
+
+    enum class MessageType : std::uint8_t {
+        NEW_MATCH = 1,
+        PLAY = 2,
+        PASS = 3,
+        END_MATCH = 4,
+        SPECTATE = 5,
+        JOIN_MATCH = 6,
+
+        MATCH_STATE = 16,
+        ERROR = 17,
+        MATCH_CLOSED = 18
+    };
+
+    enum class DeltaKind : std::uint8_t {
+        CARD_ADDED,
+        CARD_REMOVED,
+        POWER_CHANGED,
+        WEATHER_SET,
+        PASSED,
+        ROUND_END,
+        TURN,
+        HAND_SIZE,
+        GAME_OVER,
+        HAND_CARD_ADDED,
+        HAND_CARD_REMOVED
+    };
+
+    // player is 0/1, or 2 for "nobody" (drawn round or game).
+    // Field use per kind:
+    //   CARD_ADDED     player zone slot card value=power
+    //   CARD_REMOVED   player zone slot
+    //   POWER_CHANGED  player zone slot value=power
+    //   WEATHER_SET    zone value=WeatherType
+    //   PASSED, TURN   player
+    //   ROUND_END      player=winner value=next round
+    //   HAND_SIZE      player value=cards in hand
+    //   GAME_OVER      player=winner
+    //   HAND_CARD_ADDED    player slot card, only to that player's seat
+    //   HAND_CARD_REMOVED  player slot, only to that player's seat
+    struct Delta {
+        DeltaKind kind;
+        std::uint8_t player = 0;
+        std::uint8_t zone = 0;
+        std::uint32_t slot = 0;
+        std::uint32_t card = 0;
+        std::int32_t value = 0;
+
+        bool operator==(const Delta& other) const;
+    };
+
+    struct Message {
+        MessageType type = MessageType::ERROR;
+        std::uint64_t matchId = 0;
+        std::uint8_t player = 0;
+        std::uint32_t index = 0;
+        std::string text;
+        std::vector<Delta> deltas;
+
+        void clear();
+    };
+
+    enum class DecodeStatus { OK, INCOMPLETE, MALFORMED };
+
+    // Appends one complete frame to out.
+    void encode(const Message& message, std::string& out);
+
+    // Decodes the first frame in buffer. On OK, consumed is the frame size.
+    // Never reads past buffer and rejects anything not produced by encode().
+    DecodeStatus decode(std::string_view buffer, Message& message, std::size_t& consumed);
+}
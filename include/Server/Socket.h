@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+
+// Thin wrappers over POSIX sockets shared by the server and load generator.
+// Failures to set up a socket throw std::runtime_error; I/O failures are
+// reported through the return value so a dropped client never throws.
+namespace Net {
+    enum class IoStatus { OK, WOULD_BLOCK, CLOSED };
+
+    int listenTcp(unsigned short port, int backlog = 4096);
+    int connectTcp(const std::string& host, unsigned short port);
+    // Returns -1 once no connection is pending. Accepted sockets are non-blocking.
+    int acceptClient(int listenFd);
+    void setNonBlocking(int fd);
+    void closeSocket(int fd);
+
+    // Raises the open file limit as far as allowed; returns the new limit.
+    std::size_t raiseFileLimit();
+
+    // Non-blocking: append everything readable to buffer.
+    IoStatus readAvailable(int fd, std::string& buffer);
+    // Non-blocking: send from the front of buffer and erase what was sent.
+    IoStatus writePending(int fd, std::string& buffer);
+    // Non-blocking gather write of queued shared buffers, starting offset
+    // bytes into the first one. Fully sent buffers are popped.
+    IoStatus writeQueued(int fd, std::deque<std::shared_ptr<const std::string>>& queue,
+                         std::size_t& offset);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Simulator.h"
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+// Per-card totals gathered during bulk simulation. Each worker owns one
+// CardStats and only ever writes its own counters; merge() adds finished
+// workers together after the run, so no counter is shared while games play.
+class CardStats : public SimulationObserver {
+public:
+    struct Counters {
+        DeployEffect effect = DeployEffect::NONE;
+        std::uint64_t plays = 0;
+        std::uint64_t decidedPlays = 0; // plays in games that reached a winner
+        std::uint64_t wins = 0;         // of those, plays by the winner
+        std::int64_t contribution = 0;  // sum of lead gained over all rows
+        std::int64_t effectValue = 0;   // sum of realized deploy-effect value
+    };
+
+    enum class SortKey { WIN_RATE, CONTRIBUTION, PLAYS, EFFECT };
+
+    explicit CardStats(std::size_t cardCount);
+
+    void onPlay(const PlayEvent& play) override;
+    void onGameEnd(std::uint64_t game, const Game& result) override;
+
+    void merge(const CardStats& other);
+    const std::vector<Counters>& getCounters() const { return counters; }
+
+    // One line per card in the catalog, unplayed cards included.
+    void printReport(std::ostream& out, const CardCatalog& catalog, SortKey key) const;
+
+    // What a play's deploy effect actually achieved, in the unit that effect
+    // is measured in: power for damage and boosts, units for MEDIC, cards
+    // for DRAW_CARD and SPY.
+    static int realizedEffect(const PlayEvent& play);
+
+private:
+    std::vector<Counters> counters;
+    std::array<std::vector<std::uint32_t>, 2> playedThisGame;
+};
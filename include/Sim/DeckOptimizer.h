@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Simulator.h"
+#include <cstdint>
+#include <iosfwd>
+#include <random>
+#include <string>
+#include <vector>
+
+struct OptimizerConfig {
+    std::size_t deckSize = 25;          // distinct catalog cards per deck
+    Faction faction = Faction::NEUTRAL; // decks use this faction's and neutral cards
+    std::size_t population = 32;
+    unsigned generations = 20;
+    std::uint64_t gamesPerEval = 64;    // games against the reference per candidate
+    unsigned threads = 0;               // 0 = one per hardware thread
+    std::size_t elite = 2;              // best decks carried over unchanged
+    std::size_t tournament = 3;         // candidates drawn per parent pick
+    double mutationRate = 0.08;         // chance each card is swapped out
+    std::uint64_t seed = 1;
+    std::vector<std::uint32_t> reference; // opponent deck; empty = whole catalog
+    std::string checkpoint;             // resumed from and rewritten every generation
+};
+
+// Searches for the deck that beats a reference deck most often, with a
+// genetic algorithm over sets of catalog ids. Fitness is the win rate over a
+// batch of bot-vs-bot games; every candidate in a generation plays the same
+// deals, and the batches of the whole population are spread over all cores.
+class DeckOptimizer {
+public:
+    struct Candidate {
+        std::vector<std::uint32_t> cards; // sorted catalog ids
+        double fitness = -1.0;            // < 0 until evaluated
+    };
+
+    DeckOptimizer(const Simulator& simulator, OptimizerConfig config);
+
+    // Runs the remaining generations and returns the best deck seen.
+    Candidate run(std::ostream& log);
+
+    unsigned getGeneration() const { return generation; }
+    const std::vector<Candidate>& getPopulation() const { return population; }
+
+private:
+    const Simulator& simulator;
+    OptimizerConfig config;
+    std::mt19937_64 rng;
+    std::vector<std::uint32_t> allowed; // catalog ids legal for config.faction
+    unsigned generation = 0;
+    std::vector<Candidate> population;
+    Candidate best;
+
+    void seedPopulation();
+    void evaluate();
+    void breed();
+    const Candidate& pickParent();
+    Candidate crossover(const Candidate& a, const Candidate& b);
+    void mutate(Candidate& child);
+
+    bool loadCheckpoint();
+    void saveCheckpoint() const;
+};
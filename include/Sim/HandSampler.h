@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../Core/CardCatalog.h"
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+class Game;
+
+// One guess at what a player cannot see. Both spans point into the
+// sampler and stay valid until its next call.
+struct Determinization {
+    const std::uint32_t* hand;  // catalog ids
+    std::size_t handSize;
+    const std::uint32_t* deck;  // top of the deck first
+    std::size_t deckSize;
+};
+
+// Samples the opponent's hidden cards for determinized search: their hand
+// and the order of their deck, drawn from the cards of their deck list
+// that have not been seen yet. Seen cards are kept as per-card counts, so
+// only the counts change as the game goes on. The unseen cards sit in one
+// buffer sized by reset() that every sample() reshuffles in place, and
+// sampling never allocates.
+class HandSampler {
+public:
+    static constexpr std::size_t WHOLE_DECK = std::numeric_limits<std::size_t>::max();
+
+    HandSampler(const CardCatalog& catalog, std::uint32_t seed);
+
+    // Starts a game against a deck made of these catalog ids.
+    void reset(const std::vector<std::uint32_t>& deckList);
+
+    // A card the opponent played from their hand.
+    void reveal(std::uint32_t card);
+
+    // Reads what the opponent has on their rows and in their graveyard, plus
+    // their hand and deck sizes. Revealed cards still count when a card has
+    // since left the board.
+    void observe(const Game& game, int opponent);
+
+    // Sets the hidden sizes directly, for callers that track the game themselves.
+    void setHiddenSizes(std::size_t handSize, std::size_t deckSize);
+
+    // Shuffles just enough of the unseen cards to fill the hand and the top
+    // deckDepth cards of the deck. If fewer cards are unseen than hidden,
+    // the hand is filled first and the deck gets what is left.
+    Determinization sample(std::size_t deckDepth = WHOLE_DECK);
+
+    std::size_t unseenCount();
+
+private:
+    const CardCatalog& catalog;
+    std::mt19937 rng;
+    std::vector<std::uint16_t> deckCounts;     // per card, in the deck list
+    std::vector<std::uint16_t> revealedCounts; // per card, played so far
+    std::vector<std::uint16_t> visibleCounts;  // per card, on the board at the last observe()
+    std::vector<std::uint32_t> unseen;         // ids left over, permuted in place
+    bool stale = true;
+    std::size_t handSize = 0;
+    std::size_t deckSize = 0;
+
+    void rebuild();
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Simulator.h"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Columnar file of per-card-play rows for offline analysis.
+//
+//   header:    "GWPX", version u8, column count u8, card names (varint
+//              length + bytes each, prefixed by their count)
+//   row group: row count, then per column: encoding u8, byte length,
+//              bytes; a row count of 0 ends the file
+//
+// Each column of a group is stored either as zigzag varints or as runs of
+// (zigzag delta from the previous run's value, run length), whichever is
+// smaller. Game, round, player and outcome are nearly constant within a
+// group and collapse to a few bytes; a reader can skip any column it does
+// not need by its length.
+namespace PlayExport {
+    enum class Column : std::uint8_t {
+        GAME, ROUND, PLAYER, CARD, ZONE, POWER, ROW_DELTA, OUTCOME, COUNT
+    };
+    constexpr std::size_t COLUMN_COUNT = static_cast<std::size_t>(Column::COUNT);
+
+    // Round result for the player who made the play.
+    enum class Outcome : std::uint8_t { LOSS, DRAW, WIN };
+
+    using Columns = std::array<std::vector<std::int64_t>, COLUMN_COUNT>;
+}
+
+// Owns the output file. Thread-safe: recorders hand it whole encoded groups.
+class PlayExportWriter {
+public:
+    PlayExportWriter(const std::string& path, const CardCatalog& catalog);
+    ~PlayExportWriter();
+
+    void writeGroup(const std::string& group, std::size_t rows);
+    // Ends the file; called by the destructor if not before.
+    void finish();
+
+    std::uint64_t getRowCount() const { return rowCount; }
+    std::uint64_t getByteCount() const { return byteCount; }
+
+private:
+    std::mutex mutex;
+    std::ofstream file;
+    std::uint64_t rowCount = 0;
+    std::uint64_t byteCount = 0;
+    bool finished = false;
+};
+
+// Per-worker buffer. Plays wait for their round to end so the outcome is
+// known, then go into column vectors that only this worker touches; every
+// ROW_GROUP rows they are encoded here and handed to the writer in one go.
+class PlayRecorder : public SimulationObserver {
+public:
+    static constexpr std::size_t ROW_GROUP = 64 * 1024;
+
+    explicit PlayRecorder(PlayExportWriter& writer);
+
+    void onPlay(const PlayEvent& play) override;
+    void onRoundEnd(std::uint64_t game, int round, const std::array<int, 2>& scores) override;
+    void onGameEnd(std::uint64_t game, const Game& result) override;
+
+    // Writes whatever is left; call once the simulation is over.
+    void flush();
+
+private:
+    PlayExportWriter& writer;
+    std::vector<PlayEvent> currentRound;
+    PlayExport::Columns columns;
+    std::size_t rows = 0;
+    std::string encoded;
+};
+
+// Reads a play export one row group at a time, decoding only the columns
+// that are asked for.
+class PlayExportReader {
+public:
+    explicit PlayExportReader(const std::string& path);
+
+    const std::vector<std::string>& getCardNames() const { return cardNames; }
+
+    // Advances to the next group; false at the end of the file.
+    bool nextGroup();
+    std::size_t groupRows() const { return rows; }
+    const std::vector<std::int64_t>& column(PlayExport::Column column);
+
+private:
+    std::ifstream file;
+    std::vector<std::string> cardNames;
+    std::size_t rows = 0;
+    std::streamoff nextGroupOffset = 0;
+
+    struct Chunk {
+        std::uint8_t encoding = 0;
+        std::streamoff offset = 0;
+        std::size_t size = 0;
+        bool decoded = false;
+    };
+    std::array<Chunk, PlayExport::COLUMN_COUNT> chunks;
+    PlayExport::Columns values;
+    std::string buffer;
+};
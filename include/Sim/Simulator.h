@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../Core/CardCatalog.h"
+#include "../Core/Deck.h"
+#include "../Utils/enums.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class Game;
+
+// One card leaving a hand, seen from the player who played it.
+struct PlayEvent {
+    std::uint64_t game;
+    int round;
+    int player;
+    std::uint32_t card;  // CardCatalog id
+    CombatZone zone;
+    DeployEffect effect; // NONE for anything but units
+    int power;           // the card's power while still in hand
+    int rowDelta;        // change in the player's lead on that row; all rows for ANY
+
+    // Board and hand changes the play caused, however the rules got there.
+    int ownGain;         // power the player gained, the card's own included
+    int enemyLoss;       // power the opponent lost
+    int unitsAdded;      // units the player gained, the card itself included
+    int cardsDrawn;      // cards that came into the player's hand
+};
+
+// Sees every game one worker plays. Each worker has its own observer, so
+// implementations keep plain per-thread state and merge after run().
+class SimulationObserver {
+public:
+    virtual ~SimulationObserver() = default;
+    virtual void onPlay(const PlayEvent& /*play*/) {}
+    virtual void onRoundEnd(std::uint64_t /*game*/, int /*round*/, const std::array<int, 2>& /*scores*/) {}
+    // Also called for games stopped at the turn limit; check isGameOver().
+    virtual void onGameEnd(std::uint64_t /*game*/, const Game& /*result*/) {}
+};
+
+// Lets one worker feed several observers, e.g. an export and statistics.
+class ObserverGroup : public SimulationObserver {
+public:
+    void add(SimulationObserver* observer) { observers.push_back(observer); }
+    bool empty() const { return observers.empty(); }
+
+    void onPlay(const PlayEvent& play) override {
+        for (auto* observer : observers) observer->onPlay(play);
+    }
+    void onRoundEnd(std::uint64_t game, int round, const std::array<int, 2>& scores) override {
+        for (auto* observer : observers) observer->onRoundEnd(game, round, scores);
+    }
+    void onGameEnd(std::uint64_t game, const Game& result) override {
+        for (auto* observer : observers) observer->onGameEnd(game, result);
+    }
+
+private:
+    std::vector<SimulationObserver*> observers;
+};
+
+struct SimulationConfig {
+    std::uint64_t games = 1000;
+    unsigned threads = 0;        // 0 = one per hardware thread
+    std::uint64_t seed = 1;      // game i is dealt from seed + i
+    int maxTurns = 1000;         // a game still running after this is abandoned
+
+    // Catalog ids making up each deck; an empty list stands for the whole
+    // catalog, cut down to the deck's faction the way Game::loadDeck does.
+    std::array<std::vector<std::uint32_t>, 2> decks;
+    // Faction each deck keeps to; NEUTRAL decks may hold any card.
+    std::array<Faction, 2> factions{Faction::NEUTRAL, Faction::NEUTRAL};
+    bool swapSeats = false;      // odd games put decks[0] in the second seat
+};
+
+struct SimulationResult {
+    std::uint64_t games = 0;
+    std::uint64_t finished = 0;
+    std::array<std::uint64_t, 2> wins{0, 0}; // by deck, which is by seat unless swapSeats
+    double seconds = 0;
+};
+
+// Plays bot-vs-bot games in-process, spreading them over worker threads.
+// Both seats use the same random policy as gwent_loadgen: play a random
+// card most of the time, pass otherwise.
+class Simulator {
+public:
+    explicit Simulator(const std::string& deckFile);
+
+    const CardCatalog& getCatalog() const { return catalog; }
+    const Deck& getPool() const { return pool; }
+    unsigned workerCount(const SimulationConfig& config) const;
+
+    // observerFor(worker) is called once per worker before it starts and may
+    // return null. Observers must outlive run().
+    SimulationResult run(const SimulationConfig& config,
+                         const std::function<SimulationObserver*(unsigned worker)>& observerFor = nullptr);
+
+    // Plays game number `game` of config into result. Safe to call from many
+    // threads at once, for callers that schedule games themselves.
+    void playGame(const SimulationConfig& config, std::uint64_t game,
+                  SimulationObserver* observer, SimulationResult& result) const;
+
+private:
+    CardCatalog catalog;
+    Deck pool;                   // every catalog card once, in catalog order
+};
@@ -15,8 +15,8 @@ namespace CardUtils {
     inline std::string abilityEffectToString(AbilityEffect effect) { return enumToString(effect); }
     inline std::string deployEffectToString(DeployEffect effect) { return enumToString(effect); }
 
-    std::string weatherEffectDescription(WeatherType type);
-    std::string getDeployEffectDescription(DeployEffect effect, int value);
-    std::string getHeroAbilityDescription(HeroAbility ability, int value);
-    std::string getAbilityEffectDescription(AbilityEffect effect, int value);
+    const std::string& weatherEffectDescription(WeatherType type);
+    const std::string& getDeployEffectDescription(DeployEffect effect, int value);
+    const std::string& getHeroAbilityDescription(HeroAbility ability, int value);
+    const std::string& getAbilityEffectDescription(AbilityEffect effect, int value);
 }
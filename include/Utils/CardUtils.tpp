@@ -1,84 +1,119 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "enums.h"
+#include "EnumTable.h"
 
-namespace CardUtils {
+template<>
+struct EnumTraits<CombatZone> {
+    static constexpr bool hasTable = true;
+    static constexpr EnumEntry<CombatZone> entries[] = {
+        {CombatZone::CLOSE, "CLOSE", "Close"},
+        {CombatZone::RANGED, "RANGED", "Ranged"},
+        {CombatZone::SIEGE, "SIEGE", "Siege"},
+        {CombatZone::ANY, "ANY", "All"}
+    };
+    static constexpr auto table = makeEnumTable(entries, CombatZone::ANY, "All");
+};
 
-    template<typename EnumType>
-    std::string enumToString(EnumType) {
-        return "Unknown Enum";
-    }
+template<>
+struct EnumTraits<Faction> {
+    static constexpr bool hasTable = true;
+    static constexpr EnumEntry<Faction> entries[] = {
+        {Faction::NORTH, "NORTH", "Northern Realms"},
+        {Faction::SCOIATAEL, "SCOIATAEL", "Scoia'tael"},
+        {Faction::NILFGARD, "NILFGARD", "Nilfgaard"},
+        {Faction::MONSTERS, "MONSTERS", "Monsters"},
+        {Faction::NEUTRAL, "NEUTRAL", "Neutral"}
+    };
+    static constexpr auto table = makeEnumTable(entries, Faction::NEUTRAL, "Neutral");
+};
 
-    template<>
-    inline std::string enumToString<CombatZone>(CombatZone zone) {
-        switch (zone) {
-            case CombatZone::CLOSE: return "Close";
-            case CombatZone::RANGED: return "Ranged";
-            case CombatZone::SIEGE: return "Siege";
-            default: return "All";
-        }
-    }
+template<>
+struct EnumTraits<WeatherType> {
+    static constexpr bool hasTable = true;
+    static constexpr EnumEntry<WeatherType> entries[] = {
+        {WeatherType::BITING_FROST, "BITING_FROST", "❄️"},
+        {WeatherType::IMPENETRABLE_FOG, "IMPENETRABLE_FOG", "🌫️"},
+        {WeatherType::TORRENTIAL_RAIN, "TORRENTIAL_RAIN", "🌧️"},
+        {WeatherType::CLEAR_WEATHER, "CLEAR_WEATHER", "☀️"},
+        {WeatherType::NONE, "", "�"}
+    };
+    static constexpr auto table = makeEnumTable(entries, WeatherType::CLEAR_WEATHER, "�");
+};
 
-    template<>
-    inline std::string enumToString<Faction>(Faction faction) {
-        switch (faction) {
-            case Faction::NORTH: return "Northern Realms";
-            case Faction::SCOIATAEL: return "Scoia'tael";
-            case Faction::NILFGARD: return "Nilfgaard";
-            case Faction::MONSTERS: return "Monsters";
-            default: return "Neutral";
-        }
-    }
+template<>
+struct EnumTraits<HeroAbility> {
+    static constexpr bool hasTable = true;
+    static constexpr EnumEntry<HeroAbility> entries[] = {
+        {HeroAbility::COMMANDERS_HORN, "COMMANDERS_HORN", "Commander's Horn"},
+        {HeroAbility::SCORCH, "SCORCH", "Scorch"},
+        {HeroAbility::DECOY, "DECOY", "Decoy"},
+        {HeroAbility::ALCHEMY, "ALCHEMY", "Alchemy"},
+        {HeroAbility::REVENGE, "REVENGE", "Revenge"}
+    };
+    static constexpr auto table = makeEnumTable(entries, HeroAbility::COMMANDERS_HORN, "Unknown");
+};
 
-    template<>
-    inline std::string enumToString<WeatherType>(WeatherType type) {
-        switch (type) {
-            case WeatherType::BITING_FROST: return "❄️";
-            case WeatherType::IMPENETRABLE_FOG: return "🌫️";
-            case WeatherType::TORRENTIAL_RAIN: return "🌧️";
-            case WeatherType::CLEAR_WEATHER: return "☀️";
-            default: return "�";
-        }
-    }
+template<>
+struct EnumTraits<AbilityEffect> {
+    static constexpr bool hasTable = true;
+    static constexpr EnumEntry<AbilityEffect> entries[] = {
+        {AbilityEffect::DAMAGE_ROW, "DAMAGE_ROW", "Damage Row"},
+        {AbilityEffect::CLEAR_SKIES, "CLEAR_SKIES", "Clear Skies"},
+        {AbilityEffect::FOGLET_SPAWN, "FOGLET_SPAWN", "Foglet Spawn"},
+        {AbilityEffect::COMMANDO_TRAINING, "COMMANDO_TRAINING", "Commando Training"},
+        {AbilityEffect::VENOM_EXTRACT, "VENOM_EXTRACT", "Venom Extract"}
+    };
+    static constexpr auto table = makeEnumTable(entries, AbilityEffect::DAMAGE_ROW, "Unknown Effect");
+};
 
-    template<>
-    inline std::string enumToString<HeroAbility>(HeroAbility ability) {
-        switch (ability) {
-            case HeroAbility::COMMANDERS_HORN: return "Commander's Horn";
-            case HeroAbility::SCORCH: return "Scorch";
-            case HeroAbility::DECOY: return "Decoy";
-            case HeroAbility::ALCHEMY: return "Alchemy";
-            case HeroAbility::REVENGE: return "Revenge";
-            default: return "Unknown";
-        }
+template<>
+struct EnumTraits<DeployEffect> {
+    static constexpr bool hasTable = true;
+    static constexpr EnumEntry<DeployEffect> entries[] = {
+        {DeployEffect::NONE, "NONE", "NONE"},
+        {DeployEffect::DAMAGE_RANDOM_ENEMY, "DAMAGE_RANDOM_ENEMY", "Damage Random Enemy"},
+        {DeployEffect::BOOST_ADJACENT, "BOOST_ADJACENT", "Boost Adjacent Units"},
+        {DeployEffect::DRAW_CARD, "DRAW_CARD", "Draw Card"},
+        {DeployEffect::DESTROY_WEAKEST, "DESTROY_WEAKEST", "Destroy Weakest Enemy Unit"},
+        {DeployEffect::CLEAR_WEATHER, "CLEAR_WEATHER", "Clear Weather"},
+        {DeployEffect::SPY, "SPY", "Spy"},
+        {DeployEffect::MEDIC, "MEDIC", "Revive Unit"},
+        {DeployEffect::MORALE_BOOST, "MORALE_BOOST", "Morale Boost"}
+    };
+    static constexpr auto table = makeEnumTable(entries, DeployEffect::NONE, "NONE");
+};
+
+static_assert(EnumTraits<CombatZone>::table.isOrdered(), "CombatZone table out of enum order");
+static_assert(EnumTraits<Faction>::table.isOrdered(), "Faction table out of enum order");
+static_assert(EnumTraits<WeatherType>::table.isOrdered(), "WeatherType table out of enum order");
+static_assert(EnumTraits<HeroAbility>::table.isOrdered(), "HeroAbility table out of enum order");
+static_assert(EnumTraits<AbilityEffect>::table.isOrdered(), "AbilityEffect table out of enum order");
+static_assert(EnumTraits<DeployEffect>::table.isOrdered(), "DeployEffect table out of enum order");
+
+namespace CardUtils {
+
+    template<typename EnumType>
+    constexpr std::string_view enumName(EnumType value) {
+        static_assert(EnumTraits<EnumType>::hasTable, "No EnumTraits table for this enum");
+        return EnumTraits<EnumType>::table.name(value);
     }
 
-    template<>
-    inline std::string enumToString<AbilityEffect>(AbilityEffect effect) {
-        switch (effect) {
-            case AbilityEffect::DAMAGE_ROW: return "Damage Row";
-            case AbilityEffect::CLEAR_SKIES: return "Clear Skies";
-            case AbilityEffect::FOGLET_SPAWN: return "Foglet Spawn";
-            case AbilityEffect::COMMANDO_TRAINING: return "Commando Training";
-            case AbilityEffect::VENOM_EXTRACT: return "Venom Extract";
-            default: return "Unknown Effect";
-        }
+    template<typename EnumType>
+    constexpr EnumType enumFromString(std::string_view token) {
+        static_assert(EnumTraits<EnumType>::hasTable, "No EnumTraits table for this enum");
+        return EnumTraits<EnumType>::table.parse(token);
     }
 
-    template<>
-    inline std::string enumToString<DeployEffect>(DeployEffect effect) {
-        switch (effect) {
-            case DeployEffect::DAMAGE_RANDOM_ENEMY: return "Damage Random Enemy";
-            case DeployEffect::BOOST_ADJACENT: return "Boost Adjacent Units";
-            case DeployEffect::DRAW_CARD: return "Draw Card";
-            case DeployEffect::DESTROY_WEAKEST: return "Destroy Weakest Enemy Unit";
-            case DeployEffect::MEDIC: return "Revive Unit";
-            case DeployEffect::CLEAR_WEATHER: return "Clear Weather";
-            case DeployEffect::SPY: return "Spy";
-            case DeployEffect::MORALE_BOOST: return "Morale Boost";
-            default: return "NONE";
+    template<typename EnumType>
+    std::string enumToString(EnumType value) {
+        if constexpr (EnumTraits<EnumType>::hasTable) {
+            return std::string(enumName(value));
+        } else {
+            return "Unknown Enum";
         }
     }
 
-} 
+}
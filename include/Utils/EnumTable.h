@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+template<typename EnumType>
+struct EnumEntry {
+    EnumType value;
+    std::string_view token;
+    std::string_view name;
+};
+
+// Bidirectional enum <-> string table built at compile time.
+// Entries are given in enum order so printing is a direct index;
+// tokens are sorted once at compile time so parsing is a binary search.
+// An empty token marks a value that is printable but never parsed.
+template<typename EnumType, std::size_t N>
+class EnumTable {
+private:
+    std::array<EnumEntry<EnumType>, N> byValue;
+    std::array<EnumEntry<EnumType>, N> byToken;
+    EnumType parseFallback;
+    std::string_view nameFallback;
+
+public:
+    constexpr EnumTable(const std::array<EnumEntry<EnumType>, N>& entries,
+                        EnumType parseFallback, std::string_view nameFallback)
+        : byValue(entries), byToken(entries),
+          parseFallback(parseFallback), nameFallback(nameFallback) {
+        for (std::size_t i = 1; i < N; ++i) {
+            EnumEntry<EnumType> entry = byToken[i];
+            std::size_t j = i;
+            while (j > 0 && entry.token < byToken[j - 1].token) {
+                byToken[j] = byToken[j - 1];
+                --j;
+            }
+            byToken[j] = entry;
+        }
+    }
+
+    constexpr bool isOrdered() const {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (static_cast<std::size_t>(byValue[i].value) != i) return false;
+        }
+        return true;
+    }
+
+    constexpr std::string_view name(EnumType value) const {
+        auto index = static_cast<std::size_t>(value);
+        return index < N ? byValue[index].name : nameFallback;
+    }
+
+    constexpr std::string_view token(EnumType value) const {
+        auto index = static_cast<std::size_t>(value);
+        return index < N ? byValue[index].token : std::string_view();
+    }
+
+    constexpr EnumType parse(std::string_view token) const {
+        if (token.empty()) return parseFallback;
+        std::size_t low = 0;
+        std::size_t high = N;
+        while (low < high) {
+            std::size_t mid = low + (high - low) / 2;
+            if (byToken[mid].token < token) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return (low < N && byToken[low].token == token) ? byToken[low].value : parseFallback;
+    }
+
+    constexpr std::size_t size() const { return N; }
+};
+
+template<typename EnumType, std::size_t N>
+constexpr EnumTable<EnumType, N> makeEnumTable(const EnumEntry<EnumType> (&entries)[N],
+                                               EnumType parseFallback,
+                                               std::string_view nameFallback) {
+    std::array<EnumEntry<EnumType>, N> arr{};
+    for (std::size_t i = 0; i < N; ++i) {
+        arr[i] = entries[i];
+    }
+    return EnumTable<EnumType, N>(arr, parseFallback, nameFallback);
+}
+
+template<typename EnumType>
+struct EnumTraits {
+    static constexpr bool hasTable = false;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+
+// Fixed-capacity string builder for short UI labels, so formatting scores
+// and counters needs no heap allocation. Appends past the capacity are cut.
+template<std::size_t Capacity>
+class FixedString {
+public:
+    FixedString& append(std::string_view text) {
+        std::size_t count = text.size() < Capacity - length ? text.size() : Capacity - length;
+        text.copy(buffer + length, count);
+        length += count;
+        return *this;
+    }
+
+    FixedString& append(int value) {
+        auto result = std::to_chars(buffer + length, buffer + Capacity, value);
+        if (result.ec == std::errc()) {
+            length = static_cast<std::size_t>(result.ptr - buffer);
+        }
+        return *this;
+    }
+
+    void clear() { length = 0; }
+    std::string_view view() const { return std::string_view(buffer, length); }
+
+private:
+    char buffer[Capacity];
+    std::size_t length = 0;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Scoped CPU timers are compiled in only for non-release builds.
+#if !defined(NDEBUG) && !defined(GWENT_NO_PROFILING)
+#define GWENT_PROFILING 1
+#endif
+
+// Keeps per-scope timings for the last HISTORY frames in a ring buffer.
+class Profiler {
+public:
+    static constexpr std::size_t HISTORY = 240;
+    static constexpr std::size_t MAX_EVENTS_PER_FRAME = 256;
+
+    struct Event {
+        const char* name;
+        std::int64_t startUs;
+        std::int64_t durationUs;
+    };
+
+    struct Frame {
+        std::int64_t startUs = 0;
+        std::int64_t durationUs = 0;
+        std::vector<Event> events;
+    };
+
+    static Profiler& instance();
+
+    void beginFrame();
+    void endFrame();
+    void record(const char* name, std::int64_t startUs, std::int64_t durationUs);
+    std::int64_t now() const;
+
+    std::size_t getFrameCount() const;
+    // age 0 is the most recently completed frame.
+    const Frame& getFrame(std::size_t age) const;
+
+    bool dumpChromeTrace(const std::string& path) const;
+
+private:
+    Profiler();
+
+    std::chrono::steady_clock::time_point origin;
+    std::array<Frame, HISTORY> frames;
+    std::size_t current = 0;
+    std::size_t completed = 0;
+    bool inFrame = false;
+};
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* name)
+        : name(name), start(Profiler::instance().now()) {}
+
+    ~ScopedTimer() {
+        Profiler& profiler = Profiler::instance();
+        profiler.record(name, start, profiler.now() - start);
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    const char* name;
+    std::int64_t start;
+};
+
+#ifdef GWENT_PROFILING
+#define GWENT_PROFILE_CONCAT_INNER(a, b) a##b
+#define GWENT_PROFILE_CONCAT(a, b) GWENT_PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ScopedTimer GWENT_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PROFILE_FRAME() Profiler::instance().beginFrame()
+#define PROFILE_FRAME_END() Profiler::instance().endFrame()
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_FRAME() ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#endif
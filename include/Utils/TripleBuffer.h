@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+// Single-producer / single-consumer triple buffer. The writer always has a
+// private slot to fill, the reader always has a private slot to read, and the
+// third slot is swapped between them atomically, so neither side ever blocks.
+template<typename T>
+class TripleBuffer {
+public:
+    // Writer side.
+    T& writeSlot() { return buffers[writeIndex]; }
+
+    void publish() {
+        writeIndex = shared.exchange(writeIndex | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    // Reader side: switches to the newest published slot, if any.
+    bool acquire() {
+        if (!(shared.load(std::memory_order_acquire) & FRESH)) return false;
+        readIndex = shared.exchange(readIndex, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+
+    const T& read() const { return buffers[readIndex]; }
+
+private:
+    static constexpr unsigned INDEX_MASK = 3;
+    static constexpr unsigned FRESH = 4;
+
+    std::array<T, 3> buffers;
+    unsigned writeIndex = 0;
+    unsigned readIndex = 1;
+    std::atomic<unsigned> shared{2};
+};
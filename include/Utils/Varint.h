@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// LEB128 varints shared by the wire protocol and the on-disk formats.
+namespace Varint {
+    inline void putVarint(std::string& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    inline void putSigned(std::string& out, std::int32_t value) {
+        putVarint(out, (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31));
+    }
+
+    class Reader {
+    public:
+        explicit Reader(std::string_view data) : data(data) {}
+
+        bool ok() const { return valid; }
+        bool atEnd() const { return position == data.size(); }
+        std::size_t offset() const { return position; }
+
+        std::uint8_t byte() {
+            if (position >= data.size()) return fail();
+            return static_cast<std::uint8_t>(data[position++]);
+        }
+
+        // Only the shortest encoding of a value is accepted, so every value
+        // has exactly one valid form.
+        std::uint64_t varint(unsigned maxBytes = 10) {
+            std::uint64_t value = 0;
+            for (unsigned i = 0; i < maxBytes; ++i) {
+                if (position >= data.size()) return fail();
+                std::uint8_t b = static_cast<std::uint8_t>(data[position++]);
+                // The tenth byte holds bit 63 and nothing above it.
+                if (i == 9 && b > 1) return fail();
+                value |= static_cast<std::uint64_t>(b & 0x7F) << (7 * i);
+                if (!(b & 0x80)) {
+                    // A zero final byte after the first one is padding.
+                    if (b == 0 && i > 0) return fail();
+                    return value;
+                }
+            }
+            return fail();
+        }
+
+        std::uint32_t varint32() {
+            std::uint64_t value = varint(5);
+            return value > 0xFFFFFFFFu ? fail() : static_cast<std::uint32_t>(value);
+        }
+
+        std::int32_t signed32() {
+            std::uint32_t raw = varint32();
+            return static_cast<std::int32_t>((raw >> 1) ^ (~(raw & 1) + 1));
+        }
+
+        std::string_view bytes(std::size_t count) {
+            if (count > data.size() - position) {
+                fail();
+                return {};
+            }
+            std::string_view result = data.substr(position, count);
+            position += count;
+            return result;
+        }
+
+    private:
+        std::string_view data;
+        std::size_t position = 0;
+        bool valid = true;
+
+        std::uint8_t fail() {
+            valid = false;
+            position = data.size();
+            return 0;
+        }
+    };
+}
@@ -42,18 +42,19 @@ void AbilityCard::applyEffect(Player& owner, Player& opponent, Board& board) {
 }
 
 void AbilityCard::handleDamageRow(Player& target, Board& board) {
+    std::ostream* out = board.getOutput();
     auto& units = board.getPlayerZone(target.getPlayerId(), zone);
     int damagedUnits = 0;
     int destroyedUnits = 0;
 
     for (auto& unit : units) {
         int originalPower = unit->getPower();
-        unit->takeDamage(effectValue);
+        unit->takeDamage(effectValue, out);
         damagedUnits++;
 
-        std::cout << "💥 Damaged " << unit->getName() 
-                 << " (Power: " << originalPower << " → " 
-                 << unit->getPower() << ")\n";
+        if (out) *out << "💥 Damaged " << unit->getName()
+                     << " (Power: " << originalPower << " → "
+                     << unit->getPower() << ")\n";
 
         if (unit->getPower() <= 0) {
             destroyedUnits++;
@@ -64,62 +65,66 @@ void AbilityCard::handleDamageRow(Player& target, Board& board) {
         board.cleanupDestroyedUnits(target.getPlayerId(), zone);
     }
 
-    std::cout << "Total damaged: " << damagedUnits << " units in " 
-             << CardUtils::zoneToString(zone) << " zone\n";
+    if (out) *out << "Total damaged: " << damagedUnits << " units in "
+                 << CardUtils::zoneToString(zone) << " zone\n";
     if (destroyedUnits > 0) {
-        std::cout << "💀 Destroyed " << destroyedUnits << " units\n";
+        if (out) *out << "💀 Destroyed " << destroyedUnits << " units\n";
     }
 }
 
 void AbilityCard::handleClearSkies(Player& owner, Board& board) {
+    std::ostream* out = board.getOutput();
     board.clearWeather();
     
     if (board.hasUnitsInZone(owner.getPlayerId(), zone)) {
         board.boostRow(owner.getPlayerId(), zone, effectValue);
-        std::cout << "☀️ Cleared weather and boosted " 
-                 << CardUtils::zoneToString(zone) << " by " 
-                 << effectValue << ".\n";
+        if (out) *out << "☀️ Cleared weather and boosted "
+                     << CardUtils::zoneToString(zone) << " by "
+                     << effectValue << ".\n";
     } else {
-        std::cout << "☀️ Cleared weather (no units in " 
-                 << CardUtils::zoneToString(zone) << ").\n";
+        if (out) *out << "☀️ Cleared weather (no units in "
+                     << CardUtils::zoneToString(zone) << ").\n";
     }
 }
 
 
 void AbilityCard::handleFogletSpawn(Player& owner,CombatZone zone, Board& board) {
+    std::ostream* out = board.getOutput();
     if (board.hasWeather(WeatherType::IMPENETRABLE_FOG)) {
         owner.playCardToBoard(
             std::make_unique<UnitCard>("Foglet", 5, zone, Faction::MONSTERS),
             board
         );
-        std::cout << "👻 Summoned a Foglet!\n";
+        if (out) *out << "👻 Summoned a Foglet!\n";
     } else {
-        std::cout << "No fog weather - Foglet not summoned\n";
+        if (out) *out << "No fog weather - Foglet not summoned\n";
     }
 }
 
 void AbilityCard::handleCommandoTraining(Player& owner, Board& board) {
+    std::ostream* out = board.getOutput();
     auto& zoneUnits = board.getPlayerZone(owner.getPlayerId(), zone);
     int boostedUnits = 0;
     
     for (auto& unit : zoneUnits) {
         unit->setPower(unit->getPower() + effectValue);
         boostedUnits++;
-        std::cout << "Boosted " << unit->getName() 
-                 << " by " << effectValue << " (New power: " 
-                 << unit->getPower() << ").\n";
+        if (out) *out << "Boosted " << unit->getName()
+                     << " by " << effectValue << " (New power: "
+                     << unit->getPower() << ").\n";
     }
     
     if (boostedUnits == 0) {
-        std::cout << "No units in " << CardUtils::zoneToString(zone) 
-                 << " zone to boost\n";
+        if (out) *out << "No units in " << CardUtils::zoneToString(zone)
+                     << " zone to boost\n";
     } else {
-        std::cout << "Total boosted: " << boostedUnits << " units in " 
-                 << CardUtils::zoneToString(zone) << " zone.\n";
+        if (out) *out << "Total boosted: " << boostedUnits << " units in "
+                     << CardUtils::zoneToString(zone) << " zone.\n";
     }
 }
 
 void AbilityCard::handleVenomExtract(Player& target, Board& board) {
+    std::ostream* out = board.getOutput();
     auto units = board.getPlayerUnits(target.getPlayerId());
     
     if (!units.empty()) {
@@ -128,17 +133,21 @@ void AbilityCard::handleVenomExtract(Player& target, Board& board) {
                 return a->getPower() < b->getPower();
             });
         
-        (*strongest)->takeDamage(effectValue);
-        std::cout << "☠️ Poisoned " << (*strongest)->getName() 
-                 << " for " << effectValue << " damage.\n";
+        (*strongest)->takeDamage(effectValue, out);
+        if (out) *out << "☠️ Poisoned " << (*strongest)->getName()
+                     << " for " << effectValue << " damage.\n";
         
         if ((*strongest)->getPower() <= 0) {
-            std::cout << "💀 " << (*strongest)->getName() << " was destroyed!\n";
+            if (out) *out << "💀 " << (*strongest)->getName() << " was destroyed!\n";
         }
     } else {
-        std::cout << "No units to poison\n";
+        if (out) *out << "No units to poison\n";
     }
 }
 sf::FloatRect AbilityCard::getGlobalBounds() const {
     return sf::FloatRect(position.x, position.y, size.x, size.y);
 }
+
+std::unique_ptr<Card> AbilityCard::clone() const {
+    return std::make_unique<AbilityCard>(*this);
+}
@@ -1,23 +1,39 @@
 #include "../include/Card/Card.h"
 #include <iostream>
+#include <atomic>
+
+namespace {
+    std::atomic<std::uint32_t> nextStateVersion{0};
+}
 
 Card::Card(const std::string& name, int power, CardType type, CombatZone zone, 
            Faction faction, const std::string& description)
     : name(name), power(power), type(type), zone(zone), 
-      faction(faction), description(description) {}
+      faction(faction), description(description),
+      stateVersion(++nextStateVersion) {}
+
+void Card::touch() {
+    stateVersion = ++nextStateVersion;
+}
+
+std::uint32_t Card::getStateVersion() const { return stateVersion; }
 
 const std::string& Card::getName() const { return name; }
 int Card::getPower() const { return power; }
-void Card::setPower(int newPower) { power = newPower; }
+void Card::setPower(int newPower) {
+    power = newPower;
+    touch();
+}
 CardType Card::getType() const { return type; }
 CombatZone Card::getZone() const { return zone; }
 Faction Card::getFaction() const { return faction; }
 const std::string& Card::getDescription() const { return description; }
 
-void Card::takeDamage(int amount) {
+void Card::takeDamage(int amount, std::ostream* out) {
     power -= amount;
-    if (power <= 0) {
-        std::cout << name << " has been destroyed!" << std::endl;
+    touch();
+    if (power <= 0 && out) {
+        *out << name << " has been destroyed!" << std::endl;
     }
 }
 WeatherType Card::getWeatherType() const { 
@@ -30,31 +30,35 @@ void HeroCard::activateAbility(Player& owner, Player& opponent, Board& board) {
 }
 
 void HeroCard::applyEffect(Player& owner, Player& opponent, Board& board) {
-    std::cout << name << " activates ability: " 
-              << CardUtils::heroAbilityToString(ability) << std::endl;
+    std::ostream* out = board.getOutput();
+    if (out) *out << name << " activates ability: "
+                  << CardUtils::heroAbilityToString(ability) << std::endl;
     triggerHeroAbility(owner, opponent, board);
 }
 
 
 void HeroCard::triggerHeroAbility(Player& owner, Player& opponent, Board& board) {
+    std::ostream* out = board.getOutput();
     switch(ability) {
         case HeroAbility::COMMANDERS_HORN:
             board.doubleRowPower(owner.getPlayerId(), zone);
-            std::cout << "Doubled power in " << CardUtils::zoneToString(zone) << " battle zone!" << std::endl;
+            if (out) *out << "Doubled power in " << CardUtils::zoneToString(zone) << " battle zone!" << std::endl;
             break;
             
             case HeroAbility::SCORCH: {
                 auto result = board.destroyStrongestEnemyUnit(owner.getPlayerId(), this);
                 
                 if (!result.destroyedName.empty()) {
-                    std::cout << "🔥 " << name << " scorched ";
-                    if (result.wasHero) {
-                        std::cout << "enemy hero. ";
+                    if (out) {
+                        *out << "🔥 " << name << " scorched ";
+                        if (result.wasHero) {
+                            *out << "enemy hero. ";
+                        }
+                        *out << result.destroyedName << " (Power: " << result.power
+                             << ") from " << CardUtils::zoneToString(result.zone) << " battle zone!\n";
                     }
-                    std::cout << result.destroyedName << " (Power: " << result.power 
-                              << ") from " << CardUtils::zoneToString(result.zone) << " battle zone!\n";
                 } else {
-                    std::cout << "No valid enemy units to scorch!\n";
+                    if (out) *out << "No valid enemy units to scorch!\n";
                 }
                 break;
             }
@@ -63,7 +67,7 @@ void HeroCard::triggerHeroAbility(Player& owner, Player& opponent, Board& board)
                 try {
                     auto& zoneCards = board.getPlayerZone(owner.getPlayerId(), zone);
                     if (zoneCards.empty()) {
-                        std::cout << "No cards in zone to decoy!\n";
+                        if (out) *out << "No cards in zone to decoy!\n";
                         break;
                     }
             
@@ -78,8 +82,8 @@ void HeroCard::triggerHeroAbility(Player& owner, Player& opponent, Board& board)
                     owner.addCardToHand(std::move(zoneCards[0]));
                     zoneCards.erase(zoneCards.begin());
                     
-                    std::cout << "Decoy returned " << cardName 
-                              <<"to hand\n";
+                    if (out) *out << "Decoy returned " << cardName
+                                  <<"to hand\n";
                 } 
                 catch (const std::exception& e) {
                     std::cerr << "Decoy failed: " << e.what() << "\n";
@@ -96,8 +100,8 @@ void HeroCard::triggerHeroAbility(Player& owner, Player& opponent, Board& board)
                     });
                 
                 (*strongest)->setPower((*strongest)->getPower() + abilityValue);
-                std::cout << "Boosted " << (*strongest)->getName() 
-                         << " by " << abilityValue << std::endl;
+                if (out) *out << "Boosted " << (*strongest)->getName()
+                             << " by " << abilityValue << std::endl;
             }
             break;
         }
@@ -106,7 +110,7 @@ void HeroCard::triggerHeroAbility(Player& owner, Player& opponent, Board& board)
             if (owner.getRoundsLost() > 0) {
                 int boost = owner.getRoundsLost() * abilityValue;
                 board.boostRow(owner.getPlayerId(), zone, boost);
-                std::cout << "Revenge boost of " << boost << " applied!" << std::endl;
+                if (out) *out << "Revenge boost of " << boost << " applied!" << std::endl;
             }
             break;
     }
@@ -118,6 +122,10 @@ sf::FloatRect HeroCard::getGlobalBounds() const {
     return sf::FloatRect(position.x, position.y, size.x, size.y);
 }
 
+std::unique_ptr<Card> HeroCard::clone() const {
+    return std::make_unique<HeroCard>(*this);
+}
+
 int HeroCard::getAbilityValue() const{
     return abilityValue;
 };
@@ -12,7 +12,7 @@ UnitCard::UnitCard(const std::string& name, int power, CombatZone zone,
     : Card(name, power, CardType::UNIT, zone, faction, 
            ""),
       isHero(isHero), deployEffect(effect), 
-      effectValue(effectValue), isSpy(isSpy) {}
+      effectValue(effectValue), isSpy(isSpy), basePower(power) {}
 
       void UnitCard::play(Player& owner, Player& opponent, Board& board) {
         auto unitCopy = std::make_unique<UnitCard>(*this);
@@ -20,18 +20,20 @@ UnitCard::UnitCard(const std::string& name, int power, CombatZone zone,
     }
 
 void UnitCard::applyEffect(Player& owner, Player& opponent, Board& board) {
-    triggerDeployEffect(owner, opponent, board);
+    triggerDeployEffect(owner, opponent, board, board.getRng());
 }
 
-void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board) {
+void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board, std::mt19937& rng) {
+    std::ostream* out = board.getOutput();
     switch(deployEffect) {
         case DeployEffect::DAMAGE_RANDOM_ENEMY: {
             auto units = board.getPlayerUnits(opponent.getPlayerId());
             if (!units.empty()) {
-                int randomIndex = rand() % units.size();
-                units[randomIndex]->takeDamage(effectValue);
-                std::cout << "Dealt " << effectValue << " damage to " 
-                     << units[randomIndex]->getName() <<"."<< std::endl;
+                std::uniform_int_distribution<std::size_t> pick(0, units.size() - 1);
+                const std::size_t randomIndex = pick(rng);
+                units[randomIndex]->takeDamage(effectValue, out);
+                if (out) *out << "Dealt " << effectValue << " damage to "
+                         << units[randomIndex]->getName() <<"."<< std::endl;
             }
             break;
         }
@@ -41,8 +43,8 @@ void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board
             for (auto unit : units) {
                 if (unit->getName() != name) {
                     unit->setPower(unit->getPower() + effectValue);
-                    std::cout << "Boosted " << unit->getName() 
-                         << " by " << effectValue <<"."<< std::endl;
+                    if (out) *out << "Boosted " << unit->getName()
+                             << " by " << effectValue <<"."<< std::endl;
                 }
             }
             break;
@@ -50,20 +52,20 @@ void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board
             
         case DeployEffect::DRAW_CARD:
             owner.drawCards(effectValue);
-            std::cout << "Drew " << effectValue << " card(s)." << std::endl;
+            if (out) *out << "Drew " << effectValue << " card(s)." << std::endl;
             break;
             
         case DeployEffect::DESTROY_WEAKEST: {
             std::string destroyedName = board.destroyWeakestUnit(opponent.getPlayerId());
             if (!destroyedName.empty()) {
-                std::cout << "Destroyed opponent's weakest unit: " << destroyedName <<".";
+                if (out) *out << "Destroyed opponent's weakest unit: " << destroyedName <<".";
             } else {
-                std::cout << "No units to destroy!\n";
+                if (out) *out << "No units to destroy!\n";
             }
             break;
         }
         case DeployEffect::MORALE_BOOST: {
-            std::cout << "DEBUG - Applying Morale Boost with value: " << this->effectValue << "\n";
+            if (out) *out << "DEBUG - Applying Morale Boost with value: " << this->effectValue << "\n";
             
             std::vector<UnitCard*> boostTargets;
             int minPower = 100000;
@@ -73,8 +75,8 @@ void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board
                 for (auto& card : zoneCards) {
                     if (auto* unit = dynamic_cast<UnitCard*>(card.get())) {
                         if (!unit->isHeroCard()) {
-                            std::cout << "DEBUG - Checking unit: " << unit->getName() 
-                                     << " with power " << unit->getPower() << "\n";
+                            if (out) *out << "DEBUG - Checking unit: " << unit->getName()
+                                         << " with power " << unit->getPower() << "\n";
                             minPower = std::min(minPower, unit->getPower());
                         }
                     }
@@ -93,12 +95,12 @@ void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board
             for (auto* unit : boostTargets) {
                 int original = unit->getPower();
                 unit->setPower(original + this->effectValue);
-                std::cout << "🎖️ Morale Boost: " << unit->getName()
-                         << " " << original << " → " << unit->getPower() << "\n";
+                if (out) *out << "🎖️ Morale Boost: " << unit->getName()
+                             << " " << original << " → " << unit->getPower() << "\n";
             }
             
-            std::cout << "Boosted " << boostTargets.size() 
-                     << " units with value " << this->effectValue << "\n";
+            if (out) *out << "Boosted " << boostTargets.size()
+                         << " units with value " << this->effectValue << "\n";
             break;
         }
             
@@ -107,7 +109,7 @@ void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board
             if (!graveyard.empty()) {
                 auto revived = move(graveyard.back());
                 graveyard.pop_back();
-                std::cout << "Revived " << revived->getName() << std::endl;
+                if (out) *out << "Revived " << revived->getName() << std::endl;
                 owner.playCardToBoard(move(revived), board);
             }
             break;
@@ -133,3 +135,7 @@ void UnitCard::triggerDeployEffect(Player& owner, Player& opponent, Board& board
 sf::FloatRect UnitCard::getGlobalBounds() const {
     return sf::FloatRect(position.x, position.y, size.x, size.y);
 }
+
+std::unique_ptr<Card> UnitCard::clone() const {
+    return std::make_unique<UnitCard>(*this);
+}
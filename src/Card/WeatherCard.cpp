@@ -12,10 +12,12 @@ WeatherCard::WeatherCard(const std::string& name, WeatherType type,
   weatherType(type), affectedZones(affectedZones), effectValue(effectValue) {}
 
 void WeatherCard::play(Player& owner, Player& opponent, Board& board) {
-    for (auto zone : affectedZones) {
-        std::cout << CardUtils::zoneToString(zone) << " ";
+    if (std::ostream* out = board.getOutput()) {
+        for (auto zone : affectedZones) {
+            *out << CardUtils::zoneToString(zone) << " ";
+        }
+        *out << std::endl;
     }
-    std::cout << std::endl;
     
     applyEffect(owner, opponent, board);
 }
@@ -23,7 +25,7 @@ void WeatherCard::play(Player& owner, Player& opponent, Board& board) {
 void WeatherCard::applyEffect(Player& owner, Player& opponent, Board& board) {
     if (weatherType == WeatherType::CLEAR_WEATHER) {
         board.clearWeather();
-        std::cout << "Weather effects cleared!" << std::endl;
+        if (std::ostream* out = board.getOutput()) *out << "Weather effects cleared!" << std::endl;
         return;
     }
 
@@ -49,3 +51,7 @@ const std::vector<CombatZone>& WeatherCard::getAffectedZones() const {
 sf::FloatRect WeatherCard::getGlobalBounds() const {
     return sf::FloatRect(position.x, position.y, size.x, size.y);
 }
+
+std::unique_ptr<Card> WeatherCard::clone() const {
+    return std::make_unique<WeatherCard>(*this);
+}
@@ -8,14 +8,6 @@
 #include <limits>
 #include <random>
 
-Board* Board::instance = nullptr;
-
-Board* Board::getInstance() {
-    if(!instance)
-        instance = new Board();
-    return instance;
-}
-
 void Board::addCard(int playerIndex, std::unique_ptr<Card> card) {
     if (playerIndex < 0 || playerIndex >= playerBoards.size()) {
         throw std::out_of_range("Invalid player index.");
@@ -164,9 +156,9 @@ void Board::applyWeatherEffectsToZone(WeatherType type, CombatZone zone, int val
                     if (auto unit = dynamic_cast<UnitCard*>(card.get())) {
                         if (!unit->isHeroCard()) {
                             unit->setPower(1);
-                            std::cout << "Set " << unit->getName() 
-                                      << " power to 1 in " 
-                                      << CardUtils::zoneToString(zone) << ".\n";
+                            if (output) *output << "Set " << unit->getName()
+                                                << " power to 1 in "
+                                                << CardUtils::zoneToString(zone) << ".\n";
                         }
                     }
                 }
@@ -196,7 +188,7 @@ void Board::clearWeather() {
     }
 
     weatherEffects.clear();
-    std::cout << "☀️ All weather effects cleared.\n";
+    if (output) *output << "☀️ All weather effects cleared.\n";
 
     for (auto& pb : playerBoards) {
         for (auto zone : affectedZones) {
@@ -206,9 +198,9 @@ void Board::clearWeather() {
                 if (auto unit = dynamic_cast<UnitCard*>(card.get())) {
                     if (!unit->isHeroCard()) {
                         unit->setPower(unit->getBasePower());
-                        std::cout << "🔄 Restored " << unit->getName() 
-                                  << " to base power (" 
-                                  << unit->getPower() << ").\n";
+                        if (output) *output << "🔄 Restored " << unit->getName()
+                                            << " to base power ("
+                                            << unit->getPower() << ").\n";
                     }
                 }
             }
@@ -329,7 +321,7 @@ void Board::damageRow(int playerIndex, CombatZone zone, int damage) {
     if (zones.count(zone)) {
         auto& cards = zones[zone];
         for (size_t i = 0; i < cards.size(); ) {
-            cards[i]->takeDamage(damage);
+            cards[i]->takeDamage(damage, output);
             if (cards[i]->getPower() <= 0) {
                 playerBoards[playerIndex].graveyard.push_back(std::move(cards[i]));
                 cards.erase(cards.begin() + i);
@@ -433,3 +425,19 @@ bool Board::hasUnitsInZone(int playerId, CombatZone zone) const {
     auto it = zones.find(zone);
     return it != zones.end() && !it->second.empty();
 }
+
+void Board::seed(std::uint32_t value) {
+    rng.seed(value);
+}
+
+std::mt19937& Board::getRng() {
+    return rng;
+}
+
+void Board::setOutput(std::ostream* stream) {
+    output = stream;
+}
+
+std::ostream* Board::getOutput() const {
+    return output;
+}
@@ -0,0 +1,34 @@
+#include "../include/Core/CardCatalog.h"
+#include "../assets/json.hpp"
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+void CardCatalog::load(const std::string& deckJson) {
+    json j;
+    try {
+        j = json::parse(deckJson);
+    } catch (const json::parse_error& e) {
+        throw std::runtime_error("JSON parse error: " + std::string(e.what()));
+    }
+    if (!j.contains("cards") || !j["cards"].is_array()) {
+        throw std::runtime_error("Invalid JSON format: missing 'cards' array");
+    }
+
+    for (const auto& cardData : j["cards"]) {
+        std::string name = cardData.value("name", "");
+        if (ids.emplace(name, static_cast<std::uint32_t>(names.size())).second) {
+            names.push_back(std::move(name));
+        }
+    }
+}
+
+std::uint32_t CardCatalog::idOf(const std::string& name) const {
+    auto it = ids.find(name);
+    return it != ids.end() ? it->second : static_cast<std::uint32_t>(names.size());
+}
+
+const std::string& CardCatalog::nameOf(std::uint32_t id) const {
+    static const std::string unknown = "Unknown";
+    return id < names.size() ? names[id] : unknown;
+}
@@ -3,6 +3,7 @@
 #include "../include/Card/HeroCard.h"
 #include "../include/Card/AbilityCard.h"
 #include "../include/Card/WeatherCard.h"
+#include "../include/Utils/CardUtils.h"
 #include <fstream>
 #include <random>
 #include <algorithm>
@@ -14,76 +15,27 @@
 using json = nlohmann::json;
 
 DeployEffect Deck::stringToDeployEffect(const std::string& str) {
-    static const std::map<std::string, DeployEffect> effects = {
-        {"DAMAGE_RANDOM_ENEMY", DeployEffect::DAMAGE_RANDOM_ENEMY},
-        {"BOOST_ADJACENT", DeployEffect::BOOST_ADJACENT},
-        {"DRAW_CARD", DeployEffect::DRAW_CARD},
-        {"DESTROY_WEAKEST", DeployEffect::DESTROY_WEAKEST},
-        {"CLEAR_WEATHER", DeployEffect::CLEAR_WEATHER},
-        {"SPY", DeployEffect::SPY},
-        {"MEDIC", DeployEffect::MEDIC},
-        {"MORALE_BOOST", DeployEffect::MORALE_BOOST}
-    };
-    auto it = effects.find(str);
-    return it != effects.end() ? it->second : DeployEffect::NONE;
+    return CardUtils::enumFromString<DeployEffect>(str);
 }
 
 HeroAbility Deck::stringToHeroAbility(const std::string& str) {
-    static const std::map<std::string, HeroAbility> abilities = {
-        {"COMMANDERS_HORN", HeroAbility::COMMANDERS_HORN},
-        {"SCORCH", HeroAbility::SCORCH},
-        {"DECOY", HeroAbility::DECOY},
-        {"ALCHEMY", HeroAbility::ALCHEMY},
-        {"REVENGE", HeroAbility::REVENGE}
-    };
-    auto it = abilities.find(str);
-    return it != abilities.end() ? it->second : HeroAbility::COMMANDERS_HORN;
+    return CardUtils::enumFromString<HeroAbility>(str);
 }
 
 AbilityEffect Deck::stringToAbilityEffect(const std::string& str) {
-    static const std::map<std::string, AbilityEffect> effects = {
-        {"DAMAGE_ROW", AbilityEffect::DAMAGE_ROW},
-        {"CLEAR_SKIES", AbilityEffect::CLEAR_SKIES},
-        {"FOGLET_SPAWN", AbilityEffect::FOGLET_SPAWN},
-        {"COMMANDO_TRAINING", AbilityEffect::COMMANDO_TRAINING},
-        {"VENOM_EXTRACT", AbilityEffect::VENOM_EXTRACT}
-    };
-    auto it = effects.find(str);
-    return it != effects.end() ? it->second : AbilityEffect::DAMAGE_ROW;
+    return CardUtils::enumFromString<AbilityEffect>(str);
 }
 
 WeatherType Deck::stringToWeatherType(const std::string& str) {
-    static const std::map<std::string, WeatherType> types = {
-        {"BITING_FROST", WeatherType::BITING_FROST},
-        {"IMPENETRABLE_FOG", WeatherType::IMPENETRABLE_FOG},
-        {"TORRENTIAL_RAIN", WeatherType::TORRENTIAL_RAIN},
-        {"CLEAR_WEATHER", WeatherType::CLEAR_WEATHER}
-    };
-    auto it = types.find(str);
-    return it != types.end() ? it->second : WeatherType::CLEAR_WEATHER;
+    return CardUtils::enumFromString<WeatherType>(str);
 }
 
 CombatZone Deck::stringToCombatZone(const std::string& str) {
-    static const std::map<std::string, CombatZone> zones = {
-        {"CLOSE", CombatZone::CLOSE},
-        {"RANGED", CombatZone::RANGED},
-        {"SIEGE", CombatZone::SIEGE},
-        {"ANY", CombatZone::ANY}
-    };
-    auto it = zones.find(str);
-    return it != zones.end() ? it->second : CombatZone::ANY;
+    return CardUtils::enumFromString<CombatZone>(str);
 }
 
 Faction Deck::stringToFaction(const std::string& str) {
-    static const std::map<std::string, Faction> factions = {
-        {"NORTH", Faction::NORTH},
-        {"SCOIATAEL", Faction::SCOIATAEL},
-        {"NILFGARD", Faction::NILFGARD},
-        {"MONSTERS", Faction::MONSTERS},
-        {"NEUTRAL", Faction::NEUTRAL}
-    };
-    auto it = factions.find(str);
-    return it != factions.end() ? it->second : Faction::NEUTRAL;
+    return CardUtils::enumFromString<Faction>(str);
 }
 
 void Deck::loadFromJson(const std::string& filename) {
@@ -91,10 +43,13 @@ void Deck::loadFromJson(const std::string& filename) {
     if (!file.is_open()) {
         throw std::runtime_error("Failed to open file: " + filename);
     }
+    loadFromJson(file);
+}
 
+void Deck::loadFromJson(std::istream& input) {
     json j;
     try {
-        file >> j;
+        input >> j;
     } catch (const json::parse_error& e) {
         throw std::runtime_error("JSON parse error: " + std::string(e.what()));
     }
@@ -186,11 +141,17 @@ CombatZone Deck::getDefaultZoneForWeather(WeatherType type) const {
     }
 }
 
+void Deck::seed(std::uint32_t value) {
+    rng.seed(value);
+}
+
+void Deck::setOutput(std::ostream* stream) {
+    output = stream;
+}
+
 void Deck::shuffle() {
-    std::random_device rd;
-    std::mt19937 g(rd());
-    std::shuffle(cards.begin(), cards.end(), g);
-    std::cout << "Deck shuffled (" << cards.size() << " cards)" << std::endl;
+    std::shuffle(cards.begin(), cards.end(), rng);
+    if (output) *output << "Deck shuffled (" << cards.size() << " cards)" << std::endl;
 }
 
 std::unique_ptr<Card> Deck::drawCard() {
@@ -219,6 +180,24 @@ size_t Deck::size() const {
     return cards.size();
 }
 
+const std::vector<std::unique_ptr<Card>>& Deck::getCards() const {
+    return cards;
+}
+
+void Deck::filter(const std::function<bool(const Card&)>& keep) {
+    cards.erase(std::remove_if(cards.begin(), cards.end(),
+                               [&](const std::unique_ptr<Card>& card) { return !keep(*card); }),
+                cards.end());
+}
+
+Faction Deck::getFaction() const {
+    return faction;
+}
+
+void Deck::setFaction(Faction value) {
+    faction = value;
+}
+
 size_t Deck::graveyardSize() const {
     return graveyard.size();
 }
@@ -229,5 +208,5 @@ void Deck::reshuffleGraveyard() {
     }
     graveyard.clear();
     shuffle();
-    std::cout << "Reshuffled graveyard into deck (" << cards.size() << " cards)" << std::endl;
+    if (output) *output << "Reshuffled graveyard into deck (" << cards.size() << " cards)" << std::endl;
 }
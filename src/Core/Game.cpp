@@ -1,7 +1,10 @@
 #include "../include/Core/Game.h"
+#include "../include/Core/DeckBuilder.h"
 #include "../include/Utils/CardUtils.h"
+#include <fstream>
 #include <iostream>
 #include <ctime>
+#include <random>
 #include <stdexcept>
 
 Game::Game(const std::string& player1Name, const std::string& player2Name) 
@@ -12,21 +15,64 @@ Game::Game(const std::string& player1Name, const std::string& player2Name)
 
     players[0].setOpponent(&players[1]);
     players[1].setOpponent(&players[0]);
-    
-    players[0].setGameReference(this);
-    players[1].setGameReference(this);
+    setSeed(std::random_device{}());
+}
 
+void Game::setSeed(std::uint32_t value) {
+    seed = value;
+    board.seed(value);
+    for (int i = 0; i < 2; ++i) {
+        if (Deck* own = players[i].getDeck()) own->seed(value + 1 + static_cast<std::uint32_t>(i));
+    }
+}
+
+void Game::setOutput(std::ostream* stream) {
+    output = stream;
+    board.setOutput(stream);
+    players[0].setOutput(stream);
+    players[1].setOutput(stream);
+}
+
+std::uint32_t Game::getSeed() const {
+    return seed;
+}
 
+void Game::loadDeck(const std::string& filename, Faction first, Faction second) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to load deck: Failed to open file: " + filename);
+    }
+    loadDeck(file, first, second);
 }
-void Game::loadDeck(const std::string& filename) {
+
+void Game::loadDeck(std::istream& input, Faction first, Faction second) {
     try {
-        deck.loadFromJson(filename);
-        players[0].setDeck(&deck);
-        players[1].setDeck(&deck);
+        Deck pool;
+        pool.loadFromJson(input);
+        setPlayerDecks(buildDeck(pool, first), buildDeck(pool, second));
     } catch (const std::exception& e) {
         throw std::runtime_error("Failed to load deck: " + std::string(e.what()));
     }
 }
+
+std::unique_ptr<Deck> Game::buildDeck(const Deck& pool, Faction faction) {
+    DeckBuilder builder;
+    builder.addCopies(pool).forFaction(faction).minSize(MIN_DECK_SIZE);
+    if (faction != Faction::NEUTRAL) {
+        builder.maxSize(MAX_DECK_SIZE);
+    }
+    return builder.build();
+}
+
+void Game::setPlayerDecks(std::unique_ptr<Deck> first, std::unique_ptr<Deck> second) {
+    if (!first || !second) {
+        throw std::invalid_argument("Both players need a deck");
+    }
+    players[0].setDeck(std::move(first));
+    players[1].setDeck(std::move(second));
+    setSeed(seed);
+}
+
 void Game::update(float deltaTime) {
     if (gameOver) return;
     
@@ -39,23 +85,29 @@ void Game::update(float deltaTime) {
 }
 
 void Game::startGame() {
-    if (deck.size() < 20) {
-        throw std::runtime_error("Not enough cards in deck to start game");
+    for (auto& player : players) {
+        Deck* own = player.getDeck();
+        if (!own || own->size() < static_cast<std::size_t>(OPENING_HAND)) {
+            throw std::runtime_error("Not enough cards in deck to start game");
+        }
+        own->shuffle();
     }
-
-    deck.shuffle();
     
-    players[0].drawCards(10);
-    players[1].drawCards(10);
+    players[0].drawCards(OPENING_HAND);
+    players[1].drawCards(OPENING_HAND);
     
     currentRound = 1;
+    roundScores.clear();
     currentPlayerIndex = 0;
     gameOver = false;
     resetPassStates();
+    markStateChanged();
     
-    std::cout << "\n=== Game Started ===\n";
-    std::cout << players[0].getName() << " vs " << players[1].getName() << "\n";
-    std::cout << players[currentPlayerIndex].getName() << " goes first.\n";
+    if (output) {
+        *output << "\n=== Game Started ===\n";
+        *output << players[0].getName() << " vs " << players[1].getName() << "\n";
+        *output << players[currentPlayerIndex].getName() << " goes first.\n";
+    }
 }
 
 Player& Game::getCurrentPlayer() {
@@ -94,9 +146,12 @@ void Game::nextRound() {
     
     players[0].drawCards(3);
     players[1].drawCards(3);
+    markStateChanged();
     
-    std::cout << "\n=== Round " << currentRound << " ===\n";
-    std::cout << players[currentPlayerIndex].getName() << " starts this round.\n";
+    if (output) {
+        *output << "\n=== Round " << currentRound << " ===\n";
+        *output << players[currentPlayerIndex].getName() << " starts this round.\n";
+    }
 }
 
 void Game::playCard(int playerIndex, int cardIndex) {
@@ -124,6 +179,7 @@ void Game::endTurn() {
     
     for (auto& card : players[0].getHand()) card->positionSet = false;
     for (auto& card : players[1].getHand()) card->positionSet = false;
+    markStateChanged();
     
     if (playerPassed[0] && playerPassed[1]) {
         calculateRoundWinner();
@@ -147,7 +203,7 @@ void Game::pass(int playerIndex) {
     }
 
     playerPassed[playerIndex] = true;
-    std::cout << players[playerIndex].getName() << " passes." << std::endl;
+    if (output) *output << players[playerIndex].getName() << " passes." << std::endl;
     endTurn();
 }
 
@@ -160,65 +216,74 @@ void Game::calculateRoundWinner() {
         player2Score += board.getPlayerPower(1, zone);
     }
 
-    std::cout << "\n=== Round Results ===\n";
-    std::cout << players[0].getName() << ": " << player1Score << " points\n";
-    std::cout << players[1].getName() << ": " << player2Score << " points\n";
+    roundScores.push_back({player1Score, player2Score});
+
+    if (output) {
+        *output << "\n=== Round Results ===\n";
+        *output << players[0].getName() << ": " << player1Score << " points\n";
+        *output << players[1].getName() << ": " << player2Score << " points\n";
+    }
 
     if (player1Score > player2Score) {
         players[0].winRound();
-        std::cout << players[0].getName() << " wins the round!\n";
+        if (output) *output << players[0].getName() << " wins the round!\n";
     } else if (player2Score > player1Score) {
         players[1].winRound();
-        std::cout << players[1].getName() << " wins the round!\n";
+        if (output) *output << players[1].getName() << " wins the round!\n";
     } else {
-        std::cout << "Round ends in a draw! No winner.\n";
+        if (output) *output << "Round ends in a draw! No winner.\n";
     }
 
     if (players[0].getRoundsWon() >= 2) {
         gameOver = true;
-        std::cout << "\n=== Game Over ===\n";
-        std::cout << players[0].getName() << " wins the game!\n";
+        if (output) *output << "\n=== Game Over ===\n" << players[0].getName() << " wins the game!\n";
     } else if (players[1].getRoundsWon() >= 2) {
         gameOver = true;
-        std::cout << "\n=== Game Over ===\n";
-        std::cout << players[1].getName() << " wins the game!\n";
+        if (output) *output << "\n=== Game Over ===\n" << players[1].getName() << " wins the game!\n";
     }
 }
 
 void Game::printGameState() const {
-    std::cout << "\n=== Game State ===\n";
-    std::cout << "Round: " << currentRound << "\n";
-    std::cout << "Current turn: " << players[currentPlayerIndex].getName() << "\n";
+    if (!output) return;
+    std::ostream& out = *output;
+
+    out << "\n=== Game State ===\n";
+    out << "Round: " << currentRound << "\n";
+    out << "Current turn: " << players[currentPlayerIndex].getName() << "\n";
     
     for (int i = 0; i < 2; ++i) {
-        std::cout << "\n" << players[i].getName() << ":\n";
-        std::cout << "  Rounds won: " << players[i].getRoundsWon() << "/2\n";
-        std::cout << "  Cards in hand: " << players[i].getHandSize() << "\n";
+        out << "\n" << players[i].getName() << ":\n";
+        out << "  Rounds won: " << players[i].getRoundsWon() << "/2\n";
+        out << "  Cards in hand: " << players[i].getHandSize() << "\n";
         
-        std::cout << "  Board presence:\n";
+        out << "  Board presence:\n";
         for (auto zone : {CombatZone::CLOSE, CombatZone::RANGED, CombatZone::SIEGE}) {
             int power = board.getPlayerPower(i, zone);
             if (power > 0) {
-                std::cout << "    " << CardUtils::zoneToString(zone) 
+                out << "    " << CardUtils::zoneToString(zone) 
                           << " combat: " << power << " power\n";
             }
         }
     }
     
     if (board.hasWeather(CombatZone::CLOSE)) {
-        std::cout << "\nWeather effect in Close combat: " 
+        out << "\nWeather effect in Close combat: " 
                   << CardUtils::weatherTypeToSymbol(board.getWeatherType(CombatZone::CLOSE)) << "\n";
     }
     if (board.hasWeather(CombatZone::RANGED)) {
-        std::cout << "Weather effect in Ranged combat: " 
+        out << "Weather effect in Ranged combat: " 
                   << CardUtils::weatherTypeToSymbol(board.getWeatherType(CombatZone::RANGED)) << "\n";
     }
     if (board.hasWeather(CombatZone::SIEGE)) {
-        std::cout << "Weather effect in Siege combat: " 
+        out << "Weather effect in Siege combat: " 
                   << CardUtils::weatherTypeToSymbol(board.getWeatherType(CombatZone::SIEGE)) << "\n";
     }
 }
 
+const std::vector<std::array<int, 2>>& Game::getRoundScores() const {
+    return roundScores;
+}
+
 bool Game::isGameOver() const {
     return gameOver;
 }
@@ -242,6 +307,14 @@ bool Game::haveBothPlayersPassed() const {
     return playerPassed[0] && playerPassed[1];
 }
 
+bool Game::hasPassed(int playerIndex) const {
+    return playerPassed[playerIndex];
+}
+
+int Game::getCurrentRound() const {
+    return currentRound;
+}
+
 const Board& Game::getBoard() const {
     return board;
 }
@@ -265,3 +338,11 @@ int Game::getCurrentPlayerIndex() const {
 Board& Game::getBoard() { 
     return board; 
 }
+
+std::uint64_t Game::getStateVersion() const {
+    return stateVersion;
+}
+
+void Game::markStateChanged() {
+    ++stateVersion;
+}
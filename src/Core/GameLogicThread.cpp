@@ -0,0 +1,134 @@
+#include "../include/Core/GameLogicThread.h"
+#include "../include/Core/Game.h"
+#include "../include/Card/HeroCard.h"
+#include <exception>
+
+GameLogicThread::GameLogicThread(std::unique_ptr<Game> game) : game(std::move(game)) {}
+
+GameLogicThread::~GameLogicThread() {
+    stop();
+}
+
+void GameLogicThread::start() {
+    if (thread.joinable()) return;
+    publish();
+    thread = std::thread(&GameLogicThread::run, this);
+}
+
+void GameLogicThread::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (thread.joinable()) thread.join();
+}
+
+void GameLogicThread::post(const GameCommand& command) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(command);
+    }
+    postedCommands.fetch_add(1, std::memory_order_relaxed);
+    wake.notify_one();
+}
+
+bool GameLogicThread::acquireSnapshot() {
+    return snapshots.acquire();
+}
+
+const GameSnapshot& GameLogicThread::snapshot() const {
+    return snapshots.read();
+}
+
+bool GameLogicThread::hasPendingCommands() const {
+    return postedCommands.load(std::memory_order_relaxed) != snapshot().processedCommands;
+}
+
+void GameLogicThread::run() {
+    std::vector<GameCommand> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (stopping) return;
+            batch.swap(queue);
+        }
+
+        // Everything queued since the last wake-up is applied before a single
+        // snapshot is published.
+        for (const auto& command : batch) {
+            if (!game->isGameOver()) {
+                execute(command);
+                game->update(0.f);
+            }
+            ++processedCommands;
+        }
+        batch.clear();
+        publish();
+    }
+}
+
+void GameLogicThread::execute(const GameCommand& command) {
+    Player& player = game->getPlayer(command.playerId);
+
+    try {
+        switch (command.type) {
+            case GameCommand::Type::SELECT_CARD:
+                player.selectCard(command.index);
+                break;
+
+            case GameCommand::Type::DESELECT_CARD:
+                player.deselectCard();
+                break;
+
+            case GameCommand::Type::PLAY_CARD:
+                game->playCard(command.playerId, command.index);
+                player.deselectCard();
+                break;
+
+            case GameCommand::Type::CLICK_CARD:
+                if (player.getSelectedCardIndex() == command.index) {
+                    game->playCard(command.playerId, command.index);
+                    player.deselectCard();
+                } else {
+                    player.selectCard(command.index);
+                }
+                break;
+
+            case GameCommand::Type::PASS:
+                game->pass(command.playerId);
+                break;
+
+            case GameCommand::Type::END_TURN:
+                game->endTurn();
+                break;
+
+            case GameCommand::Type::ACTIVATE_HERO: {
+                auto& cards = game->getBoard().getPlayerZone(command.playerId, command.zone);
+                if (command.index < 0 || command.index >= static_cast<int>(cards.size())) break;
+
+                auto* hero = dynamic_cast<HeroCard*>(cards[command.index].get());
+                if (hero && player.canUseHeroAbility(hero->getName())) {
+                    hero->activateAbility(player, game->getPlayer(1 - command.playerId), game->getBoard());
+                    player.markHeroAbilityUsed(hero->getName());
+                    game->markStateChanged();
+                }
+                break;
+            }
+        }
+    } catch (const std::exception& e) {
+        message = e.what();
+        ++messageId;
+    }
+}
+
+void GameLogicThread::publish() {
+    GameSnapshot& slot = snapshots.writeSlot();
+    slot.capture(*game);
+    slot.sequence = ++sequence;
+    slot.processedCommands = processedCommands;
+    slot.messageId = messageId;
+    slot.message = message;
+    snapshots.publish();
+}
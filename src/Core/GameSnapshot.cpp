@@ -0,0 +1,129 @@
+#include "../include/Core/GameSnapshot.h"
+#include "../include/Core/Game.h"
+#include "../include/Card/UnitCard.h"
+#include "../include/Card/HeroCard.h"
+#include "../include/Card/AbilityCard.h"
+#include "../include/Card/WeatherCard.h"
+#include "../include/Utils/CardUtils.h"
+#include <sstream>
+
+namespace {
+    void captureCard(const Card& card, CardView& view) {
+        view.identity = &card;
+        if (view.version == card.getStateVersion() && !view.tooltip.empty()) return;
+
+        view.version = card.getStateVersion();
+        view.name = card.getName();
+        view.type = card.getType();
+        view.zone = card.getZone();
+        view.faction = card.getFaction();
+        view.weather = card.getType() == CardType::WEATHER ? card.getWeatherType() : WeatherType::NONE;
+        view.power = card.getPower();
+        view.tooltip = describeCard(card);
+    }
+
+    void captureCards(const std::vector<std::unique_ptr<Card>>& cards, std::vector<CardView>& views) {
+        views.resize(cards.size());
+        for (std::size_t i = 0; i < cards.size(); ++i) {
+            captureCard(*cards[i], views[i]);
+        }
+    }
+}
+
+void GameSnapshot::capture(const Game& game) {
+    currentPlayer = game.getCurrentPlayerIndex();
+    gameOver = game.isGameOver();
+    winnerName = gameOver ? game.getWinnerName() : std::string();
+
+    for (int i = 0; i < 2; ++i) {
+        const Player& player = game.getPlayer(i);
+        PlayerView& view = players[i];
+        view.id = player.getPlayerId();
+        view.name = player.getName();
+        view.roundsWon = player.getRoundsWon();
+        view.selectedIndex = player.getSelectedCardIndex();
+        captureCards(player.getHand(), view.hand);
+
+        for (int zoneIdx = 0; zoneIdx < 3; ++zoneIdx) {
+            CombatZone zone = static_cast<CombatZone>(zoneIdx);
+            captureCards(game.getBoard().getPlayerZone(i, zone), view.zones[zoneIdx]);
+            view.zonePower[zoneIdx] = game.getBoard().getPlayerPower(i, zone);
+        }
+    }
+}
+
+std::string describeCard(const Card& card) {
+    std::stringstream tooltip;
+    
+    tooltip << "Name: " << card.getName() << "\n";
+    tooltip << "Faction: " << CardUtils::factionToString(card.getFaction()) << "\n";
+    tooltip << "Zone: " << CardUtils::zoneToString(card.getZone()) << "\n";
+
+    try {
+        switch(card.getType()) {
+            case CardType::UNIT: {
+                const UnitCard* unit = dynamic_cast<const UnitCard*>(&card);
+                if (unit) {
+                    tooltip << "Type: Unit Card\n";
+                    tooltip << "Power: " << unit->getPower() << "\n";
+                    if (unit->getDeployEffect() != DeployEffect::NONE) {
+                        tooltip << "Deploy: " 
+                              << CardUtils::getDeployEffectDescription(
+                                  unit->getDeployEffect(), 
+                                  unit->getEffectValue()
+                              ) << "\n";
+                    }
+                }
+                break;
+            }
+            
+            case CardType::HERO: {
+                const HeroCard* hero = dynamic_cast<const HeroCard*>(&card);
+                if (hero) {
+                    tooltip << "Type: Hero Card\n";
+                    tooltip << "Power: " << hero->getPower() << "\n";
+                    tooltip << "Ability: " 
+                    << CardUtils::getHeroAbilityDescription(
+                        hero->getAbility(),
+                        hero->getAbilityValue()
+                    ) << "\n";
+          }
+          break;
+      }
+            
+            case CardType::ABILITY: {
+                const AbilityCard* ability = dynamic_cast<const AbilityCard*>(&card);
+                if (ability) {
+                    tooltip << "Type: Ability Card\n";
+                    tooltip << "Effect: " 
+                          << CardUtils::getAbilityEffectDescription(
+                              ability->getEffect(),
+                              ability->getEffectValue()
+                          ) << "\n";
+                }
+                break;
+            }
+            
+            case CardType::WEATHER: {
+                const WeatherCard* weather = dynamic_cast<const WeatherCard*>(&card);
+                if (weather) {
+                    tooltip << "Type: Weather Card\n";
+                    tooltip << "Weather Effect: " 
+                          << CardUtils::weatherEffectDescription(weather->getWeatherType()) << "\n";
+                }
+                break;
+            }
+            
+            default:
+                tooltip << "Special card effect\n";
+        }
+    } catch (const std::bad_cast& e) {
+        tooltip << "\n[Error: Invalid card type conversion]";
+    }
+
+    if (!card.getDescription().empty()) {
+        tooltip << "\n" << card.getDescription();
+    }
+
+    return tooltip.str();
+}
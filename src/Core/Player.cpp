@@ -35,10 +35,24 @@ const Card* Player::getSelectedCard() const {
 
 Player::Player(const std::string& name, int id, int startingLifepoints)
     : name(name), lifepoints(startingLifepoints), 
-      roundsWon(0), playerId(id), deck(nullptr) {}
+      roundsWon(0), playerId(id) {}
 
-void Player::setDeck(Deck* d) {
-    deck = d;
+void Player::setDeck(std::unique_ptr<Deck> d) {
+    deck = std::move(d);
+    if (deck) deck->setOutput(output);
+}
+
+void Player::setOutput(std::ostream* stream) {
+    output = stream;
+    if (deck) deck->setOutput(stream);
+}
+
+Deck* Player::getDeck() {
+    return deck.get();
+}
+
+const Deck* Player::getDeck() const {
+    return deck.get();
 }
 
 void Player::drawCard() {
@@ -49,9 +63,9 @@ void Player::drawCard() {
     auto card = deck->drawCard();
     if (card) {
         hand.push_back(std::move(card));
-        std::cout << name << " drew a card. Hand size: " << hand.size() << std::endl;
+        if (output) *output << name << " drew a card. Hand size: " << hand.size() << std::endl;
     } else {
-        std::cout << name << " cannot draw - deck is empty!" << std::endl;
+        if (output) *output << name << " cannot draw - deck is empty!" << std::endl;
     }
 }
 
@@ -71,8 +85,8 @@ void Player::playCard(int index, Player& opponent, Board& board) {
     }
 
     Card* card = hand[index].get();
-    std::cout << name << " plays " << card->getName() 
-              << " (Power: " << card->getPower() << ")" << std::endl;
+    if (output) *output << name << " plays " << card->getName()
+                        << " (Power: " << card->getPower() << ")" << std::endl;
 
     if (card->getType() == CardType::ABILITY) {
         if (auto ability = dynamic_cast<AbilityCard*>(card)) {
@@ -104,8 +118,8 @@ void Player::discardCard(size_t handIndex) {
     graveyard.push_back(std::move(hand[handIndex]));
     hand.erase(hand.begin() + handIndex);
     
-    std::cout << name << " discarded " << graveyard.back()->getName() 
-              << " to graveyard (size: " << graveyard.size() << ")\n";
+    if (output) *output << name << " discarded " << graveyard.back()->getName()
+                        << " to graveyard (size: " << graveyard.size() << ")\n";
 }
 
 void Player::addCardToHand(std::unique_ptr<Card> card) {
@@ -143,13 +157,13 @@ int Player::getPlayerId() const {
 void Player::loseLifepoint() {
     if (lifepoints > 0) {
         lifepoints--;
-        std::cout << name << " lost a lifepoint. Remaining: " << lifepoints << std::endl;
+        if (output) *output << name << " lost a lifepoint. Remaining: " << lifepoints << std::endl;
     }
 }
 
 void Player::gainLifepoint() {
     lifepoints++;
-    std::cout << name << " gained a lifepoint. Total: " << lifepoints << std::endl;
+    if (output) *output << name << " gained a lifepoint. Total: " << lifepoints << std::endl;
 }
 
 bool Player::hasLost() const {
@@ -218,6 +232,7 @@ void Player::activateHeroAbility(Board& board, Player& opponent) {
         }
     }
 
+    // A prompt for whoever is at the console, so it stays on std::cout.
     if (availableHeroes.empty()) {
         std::cout << "No hero abilities available to activate this round.\n";
         return;
@@ -244,22 +259,10 @@ void Player::activateHeroAbility(Board& board, Player& opponent) {
         std::cerr << "Error activating ability: " << e.what() << "\n";
     }
 }
-    void Player::setGameWindow(GameWindow* window) {
-        gameWindow = window;
-}
-
-    GameWindow* Player::getGameWindow() const {
-        return gameWindow;
-}
-
 void Player::setOpponent(Player* opp) { 
     opponent = opp; 
 }
 
-void Player::setGameReference(Game* gameRef) { 
-    game = gameRef; 
-}
-
 Player& Player::getOpponent() const { 
     return *opponent; 
 }
@@ -0,0 +1,130 @@
+#include "../include/GUI/AssetLoader.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+AssetLoader::AssetLoader(unsigned workerCount)
+    : workerCount(std::max(1u, workerCount)) {}
+
+AssetLoader::~AssetLoader() {
+    wait();
+}
+
+std::size_t AssetLoader::request(const std::string& path) {
+    if (started) {
+        throw std::logic_error("AssetLoader: request after start");
+    }
+
+    auto it = handlesByPath.find(path);
+    if (it != handlesByPath.end()) {
+        return it->second;
+    }
+
+    jobs.push_back(Job{path});
+    handlesByPath.emplace(path, jobs.size() - 1);
+    return jobs.size() - 1;
+}
+
+void AssetLoader::setMaxImageSize(const sf::Vector2u& size) {
+    maxImageSize = size;
+}
+
+void AssetLoader::start() {
+    if (started) return;
+    started = true;
+
+    const unsigned count = std::min<unsigned>(workerCount, static_cast<unsigned>(jobs.size()));
+    for (unsigned i = 0; i < count; ++i) {
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+// Each worker claims the next unclaimed job, so every Job is only ever
+// touched by one thread until finishedJobs publishes it.
+void AssetLoader::workerLoop() {
+    for (;;) {
+        std::size_t index = nextJob.fetch_add(1);
+        if (index >= jobs.size()) return;
+
+        Job& job = jobs[index];
+        job.loaded = job.image.loadFromFile(job.path);
+        if (!job.loaded) {
+            std::cerr << "ERROR: cannot load " << job.path << "\n";
+        } else if (maxImageSize.x > 0 && maxImageSize.y > 0) {
+            job.image = downscale(job.image, maxImageSize);
+        }
+        finishedJobs.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void AssetLoader::wait() {
+    for (auto& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+    workers.clear();
+}
+
+bool AssetLoader::isDone() const {
+    return started && finishedJobs.load(std::memory_order_acquire) == jobs.size();
+}
+
+float AssetLoader::getProgress() const {
+    if (jobs.empty()) return started ? 1.f : 0.f;
+    return static_cast<float>(finishedJobs.load(std::memory_order_acquire)) / jobs.size();
+}
+
+const sf::Image* AssetLoader::getImage(std::size_t handle) const {
+    if (!isDone() || handle >= jobs.size() || !jobs[handle].loaded) return nullptr;
+    return &jobs[handle].image;
+}
+
+const std::string& AssetLoader::getPath(std::size_t handle) const {
+    return jobs.at(handle).path;
+}
+
+// Box filter: every destination pixel averages the source pixels it covers,
+// with colour weighted by alpha so transparent edges do not darken.
+sf::Image AssetLoader::downscale(const sf::Image& source, const sf::Vector2u& maxSize) {
+    const sf::Vector2u size = source.getSize();
+    if (size.x <= maxSize.x && size.y <= maxSize.y) return source;
+
+    const float scale = std::min(static_cast<float>(maxSize.x) / size.x,
+                                 static_cast<float>(maxSize.y) / size.y);
+    const unsigned width = std::max(1u, static_cast<unsigned>(size.x * scale + 0.5f));
+    const unsigned height = std::max(1u, static_cast<unsigned>(size.y * scale + 0.5f));
+
+    const sf::Uint8* src = source.getPixelsPtr();
+    std::vector<sf::Uint8> pixels(static_cast<std::size_t>(width) * height * 4);
+
+    for (unsigned y = 0; y < height; ++y) {
+        const unsigned y0 = y * size.y / height;
+        const unsigned y1 = std::max(y0 + 1, (y + 1) * size.y / height);
+        for (unsigned x = 0; x < width; ++x) {
+            const unsigned x0 = x * size.x / width;
+            const unsigned x1 = std::max(x0 + 1, (x + 1) * size.x / width);
+
+            std::uint64_t r = 0, g = 0, b = 0, a = 0;
+            for (unsigned sy = y0; sy < y1; ++sy) {
+                const sf::Uint8* row = src + (static_cast<std::size_t>(sy) * size.x + x0) * 4;
+                for (unsigned sx = x0; sx < x1; ++sx, row += 4) {
+                    r += row[0] * row[3];
+                    g += row[1] * row[3];
+                    b += row[2] * row[3];
+                    a += row[3];
+                }
+            }
+
+            const std::uint64_t count = static_cast<std::uint64_t>(x1 - x0) * (y1 - y0);
+            sf::Uint8* out = &pixels[(static_cast<std::size_t>(y) * width + x) * 4];
+            out[0] = static_cast<sf::Uint8>(a ? r / a : 0);
+            out[1] = static_cast<sf::Uint8>(a ? g / a : 0);
+            out[2] = static_cast<sf::Uint8>(a ? b / a : 0);
+            out[3] = static_cast<sf::Uint8>(a / count);
+        }
+    }
+
+    sf::Image result;
+    result.create(width, height, pixels.data());
+    return result;
+}
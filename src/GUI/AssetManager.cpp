@@ -0,0 +1,169 @@
+#include "../include/GUI/AssetManager.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+namespace {
+    const sf::Texture& emptyTexture() {
+        static const sf::Texture texture;
+        return texture;
+    }
+}
+
+TextureHandle::TextureHandle(std::shared_ptr<TextureEntry> entry) : entry(std::move(entry)) {}
+
+const sf::Texture& TextureHandle::get() const {
+    if (!entry || !entry->owner) return emptyTexture();
+    entry->owner->ensureLoaded(*entry);
+    return entry->texture;
+}
+
+bool TextureHandle::isValid() const {
+    return entry != nullptr;
+}
+
+bool TextureHandle::isLoaded() const {
+    return entry && entry->loaded;
+}
+
+const std::string& TextureHandle::getPath() const {
+    static const std::string none;
+    return entry ? entry->path : none;
+}
+
+AssetManager::AssetManager(std::size_t budgetBytes) : budget(budgetBytes) {}
+
+AssetManager::~AssetManager() {
+    for (auto& [path, entry] : entries) {
+        entry->owner = nullptr;
+    }
+}
+
+TextureHandle AssetManager::texture(const std::string& path, bool smooth) {
+    const std::string normalized = std::filesystem::path(path).lexically_normal().generic_string();
+    auto it = entries.find(normalized);
+    if (it != entries.end()) return TextureHandle(it->second);
+
+    auto entry = std::make_shared<TextureEntry>();
+    entry->owner = this;
+    entry->path = normalized;
+    entry->smooth = smooth;
+    entries.emplace(normalized, entry);
+    return TextureHandle(entry);
+}
+
+void AssetManager::ensureLoaded(TextureEntry& entry) {
+    entry.lastUse = ++useClock;
+    if (entry.loaded || entry.failed) return;
+
+    if (!entry.texture.loadFromFile(entry.path)) {
+        std::cerr << "ERROR: cannot load texture " << entry.path << "\n";
+        entry.failed = true;
+        return;
+    }
+    entry.texture.setSmooth(entry.smooth);
+    entry.mipmapped = entry.smooth && entry.texture.generateMipmap();
+    entry.bytes = textureBytes(entry.texture, entry.mipmapped);
+    entry.loaded = true;
+    loadedBytes += entry.bytes;
+
+    enforceBudget(&entry);
+}
+
+void AssetManager::unload(TextureEntry& entry) {
+    if (!entry.loaded) return;
+    entry.texture = sf::Texture();
+    loadedBytes -= entry.bytes;
+    entry.bytes = 0;
+    entry.loaded = false;
+}
+
+// Evicts least recently used textures that no handle refers to until the
+// total fits the budget again.
+void AssetManager::enforceBudget(const TextureEntry* keep) {
+    if (getTextureMemory() <= budget) return;
+
+    std::vector<std::pair<std::uint64_t, std::string>> candidates;
+    for (const auto& [path, entry] : entries) {
+        if (entry.get() != keep && entry->loaded && entry.use_count() == 1) {
+            candidates.emplace_back(entry->lastUse, path);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& [lastUse, path] : candidates) {
+        if (getTextureMemory() <= budget) break;
+        unload(*entries[path]);
+        entries.erase(path);
+    }
+
+    if (getTextureMemory() > budget) {
+        std::cerr << "WARNING: texture memory " << getTextureMemory() / 1024 << " KiB exceeds budget of "
+                  << budget / 1024 << " KiB\n";
+    }
+}
+
+void AssetManager::trackExternal(const std::string& name, const sf::Texture& texture, bool mipmapped) {
+    external[name] = textureBytes(texture, mipmapped);
+    enforceBudget(nullptr);
+}
+
+std::size_t AssetManager::collectUnused() {
+    std::size_t freed = 0;
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.use_count() == 1) {
+            freed += it->second->bytes;
+            unload(*it->second);
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return freed;
+}
+
+void AssetManager::setBudget(std::size_t budgetBytes) {
+    budget = budgetBytes;
+    enforceBudget(nullptr);
+}
+
+std::size_t AssetManager::getBudget() const {
+    return budget;
+}
+
+std::size_t AssetManager::getTextureMemory() const {
+    std::size_t total = loadedBytes;
+    for (const auto& [name, bytes] : external) {
+        total += bytes;
+    }
+    return total;
+}
+
+std::size_t AssetManager::getLoadedCount() const {
+    std::size_t count = external.size();
+    for (const auto& [path, entry] : entries) {
+        if (entry->loaded) ++count;
+    }
+    return count;
+}
+
+void AssetManager::printReport(std::ostream& out) const {
+    out << "Texture memory: " << getTextureMemory() / 1024 << " KiB / " << budget / 1024 << " KiB\n";
+    for (const auto& [name, bytes] : external) {
+        out << "  " << name << ": " << bytes / 1024 << " KiB\n";
+    }
+    for (const auto& [path, entry] : entries) {
+        out << "  " << path << ": "
+            << (entry->loaded ? std::to_string(entry->bytes / 1024) + " KiB" : std::string("not loaded"))
+            << ", " << entry.use_count() - 1 << " handle(s)\n";
+    }
+}
+
+// RGBA8 storage, which is what SFML uploads every texture as; a full mip
+// chain adds another third on top of the base level.
+std::size_t AssetManager::textureBytes(const sf::Texture& texture, bool mipmapped) {
+    sf::Vector2u size = texture.getSize();
+    std::size_t bytes = static_cast<std::size_t>(size.x) * size.y * 4;
+    return mipmapped ? bytes + bytes / 3 : bytes;
+}
@@ -0,0 +1,97 @@
+#include "../include/GUI/CardLayout.h"
+
+CardLayout::CardLayout(const sf::Vector2f& cardSize, float spacing)
+    : cardSize(cardSize), spacing(spacing) {}
+
+bool CardLayout::needsRebuild(const GameSnapshot& state, const sf::Vector2u& size) const {
+    return !built || builtVersion != state.sequence ||
+           size.x != windowSize.x || size.y != windowSize.y;
+}
+
+void CardLayout::invalidate() {
+    built = false;
+}
+
+void CardLayout::rebuild(const GameSnapshot& state, const sf::Vector2u& size) {
+    windowSize = size;
+    slots.clear();
+    rows.clear();
+
+    const PlayerView& current = state.current();
+    if (!current.hand.empty()) {
+        sf::FloatRect first = handCardRect(current.hand.size(), 0);
+        addRow(first.left, first.top, current.id, CombatZone::ANY, true, current.hand);
+    }
+
+    for (int zoneIdx = 0; zoneIdx < 3; ++zoneIdx) {
+        CombatZone zone = static_cast<CombatZone>(zoneIdx);
+        for (int playerId = 0; playerId < 2; ++playerId) {
+            sf::FloatRect first = zoneCardRect(playerId, zoneIdx, 0);
+            addRow(first.left, first.top, playerId, zone, false,
+                   state.players[playerId].zones[zoneIdx]);
+        }
+    }
+
+    builtVersion = state.sequence;
+    built = true;
+}
+
+void CardLayout::addRow(float left, float top, int playerId, CombatZone zone, bool inHand,
+                        const std::vector<CardView>& cards) {
+    if (cards.empty()) return;
+
+    Row row{top, left, left + cards.size() * (cardSize.x + spacing) - spacing,
+            slots.size(), cards.size()};
+    for (size_t i = 0; i < cards.size(); ++i) {
+        slots.push_back({
+            &cards[i],
+            sf::FloatRect(left + i * (cardSize.x + spacing), top, cardSize.x, cardSize.y),
+            playerId,
+            zone,
+            static_cast<int>(i),
+            inHand
+        });
+    }
+    rows.push_back(row);
+}
+
+const CardLayout::Slot* CardLayout::hitTest(const sf::Vector2f& point) const {
+    const float stride = cardSize.x + spacing;
+
+    for (const auto& row : rows) {
+        if (point.y < row.top || point.y >= row.top + cardSize.y) continue;
+        if (point.x < row.left || point.x >= row.right) continue;
+
+        size_t column = static_cast<size_t>((point.x - row.left) / stride);
+        if (column >= row.count) continue;
+        if (point.x - row.left - column * stride >= cardSize.x) continue;
+        return &slots[row.first + column];
+    }
+    return nullptr;
+}
+
+const std::vector<CardLayout::Slot>& CardLayout::getSlots() const {
+    return slots;
+}
+
+sf::FloatRect CardLayout::handCardRect(size_t handSize, size_t index) const {
+    const float totalWidth = handSize * cardSize.x + (handSize - 1) * spacing;
+    const float startX = (windowSize.x - totalWidth) / 2;
+    const float y = windowSize.y - cardSize.y - 20;
+    return {startX + index * (cardSize.x + spacing), y, cardSize.x, cardSize.y};
+}
+
+float CardLayout::zoneHeight() const {
+    return cardSize.y + 35.f;
+}
+
+float CardLayout::zoneTop(int zoneIndex) const {
+    const float centerY = windowSize.y / 2.f;
+    return centerY - 200.f + zoneIndex * (zoneHeight() + 15.f);
+}
+
+sf::FloatRect CardLayout::zoneCardRect(int playerId, int zoneIndex, size_t index) const {
+    const float startX = (playerId == 0) ? 60.f : windowSize.x / 2.f + 10.f;
+    const float startY = zoneTop(zoneIndex) + 30.f;
+    return {startX + index * (cardSize.x + spacing), startY, cardSize.x, cardSize.y};
+}
@@ -1,8 +1,62 @@
 #include "GUI/CardRender.h"
 #include "../include/Utils/CardUtils.h"
+#include "../include/Utils/Profiler.h"
+#include <algorithm>
 #include <iostream>
-#include <sstream>
 
+namespace {
+    // Signed distance from (px, py) to a w x h rounded rectangle at the origin.
+    float roundedRectDistance(float px, float py, float w, float h, float radius) {
+        float qx = std::abs(px - w / 2.f) - (w / 2.f - radius);
+        float qy = std::abs(py - h / 2.f) - (h / 2.f - radius);
+        float outside = std::hypot(std::max(qx, 0.f), std::max(qy, 0.f));
+        return outside + std::min(std::max(qx, qy), 0.f) - radius;
+    }
+
+    sf::Uint8 coverage(float value) {
+        return static_cast<sf::Uint8>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+    }
+
+    // Shapes are baked as white alpha masks so one image serves every tint.
+    sf::Image rasterizeShadow(unsigned width, unsigned height, float radius, float softness) {
+        const unsigned margin = static_cast<unsigned>(std::ceil(softness));
+        const float ramp = std::max(1.f, 2.f * softness);
+        sf::Image image;
+        image.create(width + 2 * margin, height + 2 * margin, sf::Color::Transparent);
+        for (unsigned y = 0; y < image.getSize().y; ++y) {
+            for (unsigned x = 0; x < image.getSize().x; ++x) {
+                float d = roundedRectDistance(x + 0.5f - margin, y + 0.5f - margin,
+                                              static_cast<float>(width), static_cast<float>(height), radius);
+                image.setPixel(x, y, sf::Color(255, 255, 255, coverage(0.5f - d / ramp)));
+            }
+        }
+        return image;
+    }
+
+    sf::Image rasterizeFrame(unsigned width, unsigned height, unsigned thickness) {
+        sf::Image image;
+        image.create(width + 2 * thickness, height + 2 * thickness, sf::Color::White);
+        for (unsigned y = thickness; y < height + thickness; ++y) {
+            for (unsigned x = thickness; x < width + thickness; ++x) {
+                image.setPixel(x, y, sf::Color::Transparent);
+            }
+        }
+        return image;
+    }
+
+    sf::Image rasterizeGlow(unsigned radius) {
+        const float r = static_cast<float>(radius);
+        sf::Image image;
+        image.create(2 * radius, 2 * radius, sf::Color::Transparent);
+        for (unsigned y = 0; y < 2 * radius; ++y) {
+            for (unsigned x = 0; x < 2 * radius; ++x) {
+                float d = std::hypot(x + 0.5f - r, y + 0.5f - r);
+                image.setPixel(x, y, sf::Color(255, 255, 255, coverage((r - d) / (r * 0.5f))));
+            }
+        }
+        return image;
+    }
+}
 
 const sf::Vector2f CardRenderer::CARD_SIZE(80.0f, 135.0f);
 
@@ -10,11 +64,9 @@ sf::Vector2f CardRenderer::getCardSize() const {
     return CARD_SIZE;
 }
 
-CardRenderer::CardRenderer(sf::Font& font, sf::RenderWindow& window) : tooltip(font, window){
-    if (!font.loadFromFile("../assets/fonts/times.ttf")) {
-        std::cerr << "Failed to load font\n";
-    }
-    
+CardRenderer::CardRenderer(const sf::Font& font, sf::RenderWindow& window, AssetManager& assets)
+    : tooltip(font, window), font(font), assets(assets) {
+
     factionColors = {
         {Faction::NORTH, sf::Color(70, 130, 180)},    
         {Faction::NILFGARD, sf::Color(47, 79, 79)},     
@@ -27,23 +79,40 @@ CardRenderer::CardRenderer(sf::Font& font, sf::RenderWindow& window) : tooltip(f
 
 
 bool CardRenderer::loadResources() {
-    auto load = [&](TripleKey key, std::string const& path) {
-        sf::Texture tex;
-        if (!tex.loadFromFile(path)) {
-            std::cerr << "ERROR: cannot load " << path << "\n";
-            return false;
-        }
-        tex.setSmooth(true);
-        textures.emplace(key, std::move(tex));
-        return true;
-    };
+    AssetLoader loader;
+    queueResources(loader);
+    loader.start();
+    loader.wait();
+    return finishLoading(loader);
+}
 
-    if (!cardBackTexture.loadFromFile("assets/cards/card_back.png")) {
-        std::cerr << "Failed to load card back texture\n";
-        return false;
-    }
+void CardRenderer::setTextureTier(TextureTier tier) {
+    textureTier = tier;
+}
 
-    bool ok = true;
+TextureTier CardRenderer::parseTextureTier(const std::string& name) {
+    if (name == "full") return TextureTier::FULL;
+    if (name == "standard") return TextureTier::STANDARD;
+    return TextureTier::HIGH;
+}
+
+void CardRenderer::queueResources(AssetLoader& loader) {
+    pendingImages.clear();
+
+    switch (textureTier) {
+        case TextureTier::FULL:
+            loader.setMaxImageSize(sf::Vector2u(0, 0));
+            break;
+        case TextureTier::HIGH:
+            loader.setMaxImageSize(sf::Vector2u(static_cast<unsigned>(CARD_SIZE.x * 2),
+                                                static_cast<unsigned>(CARD_SIZE.y * 2)));
+            break;
+        case TextureTier::STANDARD:
+            loader.setMaxImageSize(sf::Vector2u(static_cast<unsigned>(CARD_SIZE.x),
+                                                static_cast<unsigned>(CARD_SIZE.y)));
+            break;
+    }
+    pendingCardBack = loader.request("assets/cards/card_back.png");
 
     std::vector<Faction> factions = {
         Faction::NORTH, Faction::NILFGARD,
@@ -59,7 +128,7 @@ bool CardRenderer::loadResources() {
                     typeName(t) + "_" +
                     factionName(f) +
                     ".png";
-                ok &= load({z, t, f}, fn);
+                pendingImages[{z, t, f}] = loader.request(fn);
             }
         }
     }
@@ -70,7 +139,7 @@ bool CardRenderer::loadResources() {
     };
     for (auto z : abilityZones) {
         std::string fn = "assets/cards/ability_" + zoneName(z) + ".png";
-        ok &= load({z, CardType::ABILITY, Faction::NEUTRAL}, fn);
+        pendingImages[{z, CardType::ABILITY, Faction::NEUTRAL}] = loader.request(fn);
     }
 
     static const std::vector<std::pair<WeatherType, std::string>> weathers = {
@@ -82,47 +151,145 @@ bool CardRenderer::loadResources() {
     
     for (const auto& [type, name] : weathers) {
         std::string path = "assets/cards/weather_" + name + ".png";
-        sf::Texture tex;
-        if (!tex.loadFromFile(path)) {
-            std::cerr << "Failed to load weather texture: " << path << "\n";
+        pendingImages[{CombatZone::ANY, CardType::WEATHER, Faction::NEUTRAL, type}] = loader.request(path);
+    }
+}
+
+// Runs on the render thread once the loader has decoded everything:
+// packs the images into the atlas and uploads it as one texture.
+bool CardRenderer::finishLoading(const AssetLoader& loader) {
+    const sf::Image* cardBackImage = loader.getImage(pendingCardBack);
+    if (!cardBackImage) {
+        std::cerr << "Failed to load card back texture\n";
+        return false;
+    }
+    std::size_t cardBackHandle = atlas.add(*cardBackImage);
+
+    bool ok = true;
+    std::map<TripleKey, std::size_t> handles;
+    for (const auto& [key, request] : pendingImages) {
+        const sf::Image* image = loader.getImage(request);
+        if (!image) {
             ok = false;
-        } else {
-            tex.setSmooth(true);
-            textures[{CombatZone::ANY, CardType::WEATHER, Faction::NEUTRAL, type}] = std::move(tex);
+            continue;
         }
+        handles[key] = atlas.add(*image);
+    }
+    pendingImages.clear();
+
+    std::map<ShapeKey, std::size_t> shapeHandles;
+    bakeShapes(shapeHandles);
+
+    atlas.setMipmapped(true);
+    if (!atlas.build()) {
+        std::cerr << "Failed to build card texture atlas\n";
+        return false;
+    }
+
+    assets.trackExternal("card atlas", atlas.getTexture(), true);
+    cardBackRegion = atlas.getRegion(cardBackHandle);
+    for (const auto& [key, handle] : handles) {
+        textureRegions[key] = atlas.getRegion(handle);
+    }
+    for (const auto& [key, handle] : shapeHandles) {
+        shapeRegions[key] = atlas.getRegion(handle);
     }
-    
 
     return ok;
 }
 
-void CardRenderer::setupCardBase(sf::RectangleShape& base, Card const& card) const {
-    TripleKey key;
+// Card shadows, frames and glows always have the same geometry, so they are
+// rasterized once into the atlas and drawn as single tinted quads.
+void CardRenderer::bakeShapes(std::map<ShapeKey, std::size_t>& handles) {
+    const unsigned width = static_cast<unsigned>(CARD_SIZE.x);
+    const unsigned height = static_cast<unsigned>(CARD_SIZE.y);
+
+    ShapeKey shadow{BakedShape::SHADOW, static_cast<int>(width), static_cast<int>(height),
+                    static_cast<int>(CARD_CORNER_RADIUS)};
+    handles[shadow] = atlas.add(rasterizeShadow(width, height, CARD_CORNER_RADIUS, SHADOW_SOFTNESS));
+
+    for (unsigned thickness : {2u, 3u}) {
+        ShapeKey frame{BakedShape::FRAME, static_cast<int>(width), static_cast<int>(height),
+                       static_cast<int>(thickness)};
+        handles[frame] = atlas.add(rasterizeFrame(width, height, thickness));
+    }
+
+    const unsigned glowRadius = static_cast<unsigned>(GLOW_RADIUS);
+    ShapeKey glow{BakedShape::GLOW, static_cast<int>(2 * glowRadius), static_cast<int>(2 * glowRadius),
+                  static_cast<int>(glowRadius)};
+    handles[glow] = atlas.add(rasterizeGlow(glowRadius));
+}
 
-    key.zone = card.getZone();
-    key.type = card.getType();
-    key.faction = card.getFaction();
-    key.weather = WeatherType::NONE;
+void CardRenderer::appendShadow(sf::VertexArray& vertices, const sf::FloatRect& rect,
+                                const sf::Color& color) const {
+    ShapeKey key{BakedShape::SHADOW, static_cast<int>(rect.width), static_cast<int>(rect.height),
+                 static_cast<int>(CARD_CORNER_RADIUS)};
+    auto it = shapeRegions.find(key);
+    if (it == shapeRegions.end()) {
+        appendRoundedRectangle(vertices, rect, CARD_CORNER_RADIUS, color);
+        return;
+    }
+
+    const float margin = std::ceil(SHADOW_SOFTNESS);
+    appendQuad(vertices,
+               sf::FloatRect(rect.left - margin, rect.top - margin,
+                             rect.width + 2 * margin, rect.height + 2 * margin),
+               it->second, color);
+}
+
+void CardRenderer::appendCardFrame(sf::VertexArray& vertices, const sf::FloatRect& face,
+                                   float thickness, const sf::Color& color) const {
+    ShapeKey key{BakedShape::FRAME, static_cast<int>(CARD_SIZE.x), static_cast<int>(CARD_SIZE.y),
+                 static_cast<int>(thickness)};
+    auto it = shapeRegions.find(key);
+    if (it == shapeRegions.end()) {
+        appendFrame(vertices, face, thickness, color);
+        return;
+    }
+
+    appendQuad(vertices,
+               sf::FloatRect(face.left - thickness, face.top - thickness,
+                             face.width + 2 * thickness, face.height + 2 * thickness),
+               it->second, color);
+}
 
-    if (card.getType() == CardType::WEATHER) {
-        const WeatherCard* weatherCard = static_cast<const WeatherCard*>(&card);
-        key = {
+void CardRenderer::appendGlow(sf::VertexArray& vertices, const sf::Vector2f& center,
+                              const sf::Color& color) const {
+    const int diameter = static_cast<int>(2 * GLOW_RADIUS);
+    auto it = shapeRegions.find(ShapeKey{BakedShape::GLOW, diameter, diameter, static_cast<int>(GLOW_RADIUS)});
+    if (it == shapeRegions.end()) {
+        appendCircle(vertices, center, GLOW_RADIUS, 16, color);
+        return;
+    }
+
+    appendQuad(vertices,
+               sf::FloatRect(center.x - GLOW_RADIUS, center.y - GLOW_RADIUS, 2 * GLOW_RADIUS, 2 * GLOW_RADIUS),
+               it->second, color);
+}
+
+TripleKey CardRenderer::textureKeyFor(const CardView& card) const {
+    if (card.type == CardType::WEATHER) {
+        return {
             CombatZone::ANY, 
             CardType::WEATHER,
             Faction::NEUTRAL,
-            weatherCard->getWeatherType()
+            card.weather
         };
     }
+    return {card.zone, card.type, card.faction, WeatherType::NONE};
+}
 
-    auto it = textures.find(key);
-    if (it != textures.end()) {
-        base.setTexture(&it->second);
+void CardRenderer::setupCardBase(sf::RectangleShape& base, const CardView& card) const {
+    auto it = textureRegions.find(textureKeyFor(card));
+    if (it != textureRegions.end()) {
+        base.setTexture(&atlas.getTexture());
+        base.setTextureRect(it->second);
         base.setFillColor(sf::Color::White);
     } else {
         base.setFillColor(sf::Color::Magenta); 
     }
 
-    auto colIt = factionColors.find(card.getFaction());
+    auto colIt = factionColors.find(card.faction);
     if (colIt != factionColors.end()) {
         base.setOutlineColor(colIt->second);
         base.setOutlineThickness(3.f);
@@ -132,17 +299,41 @@ void CardRenderer::setupCardBase(sf::RectangleShape& base, Card const& card) con
     }
 }
 
+void CardRenderer::beginBatch() {
+    batch.clear();
+    batching = true;
+}
+
+// All card geometry samples the atlas (solid colours use its white texel),
+// so the whole batch goes out in a single draw call.
+void CardRenderer::flushBatch(sf::RenderTarget& target) {
+    batching = false;
+    if (batch.getVertexCount() == 0) return;
+
+    sf::RenderStates states(&atlas.getTexture());
+    target.draw(batch, states);
+    batch.clear();
+}
+
+void CardRenderer::endBatch(sf::VertexArray& out) {
+    batching = false;
+    out = batch;
+    batch.clear();
+}
+
+const sf::Texture& CardRenderer::getAtlasTexture() const {
+    return atlas.getTexture();
+}
 
-void CardRenderer::renderCard(sf::RenderTarget &target, const Card &card, float x, float y,
+void CardRenderer::renderCard(sf::RenderTarget &target, const CardView &card, float x, float y,
                               bool highlight, bool isCurrentPlayer)
 {
     float hoverOffset = 0.f;
     float hoverScale = 1.f;
     
     if (highlight) {
-        renderRoundedRectangle(target, 
+        appendShadow(batch,
             sf::FloatRect(x + 3, y + 3, CARD_SIZE.x, CARD_SIZE.y), 
-            CARD_CORNER_RADIUS, 
             sf::Color(0, 0, 0, 50)
         );
     }
@@ -153,54 +344,42 @@ void CardRenderer::renderCard(sf::RenderTarget &target, const Card &card, float
         hoverScale += pulse;
     }
 
-    const_cast<Card&>(card).position = sf::Vector2f(x, y);
-    const_cast<Card&>(card).size = CARD_SIZE;
-
-    renderRoundedRectangle(target, 
-                         sf::FloatRect(x + CARD_ELEVATION, y + CARD_ELEVATION, 
-                                      CARD_SIZE.x, CARD_SIZE.y),
-                         CARD_CORNER_RADIUS, 
-                         sf::Color(0, 0, 0, 100));
-    
-    sf::RectangleShape cardBase(CARD_SIZE);
-    setupCardBase(cardBase, card);
-    cardBase.setPosition(x, y + hoverOffset);
-    cardBase.setScale(hoverScale, hoverScale);
-    target.draw(cardBase);
-    
-    sf::Text titleText;
-    setupCardText(titleText, card.getName(), 18, x + 15, y + 10 + hoverOffset, 
-                 sf::Color::White, true);
-    titleText.setFont(font);
+    appendShadow(batch,
+                 sf::FloatRect(x + CARD_ELEVATION, y + CARD_ELEVATION, 
+                              CARD_SIZE.x, CARD_SIZE.y),
+                 sf::Color(0, 0, 0, 100));
     
-    sf::RectangleShape titleBg(sf::Vector2f(titleText.getLocalBounds().width + 20, 30));
-    titleBg.setPosition(x + 5, y + 5 + hoverOffset);
-    titleBg.setFillColor(factionColors.at(card.getFaction()));
-    titleBg.setOutlineColor(sf::Color::Black);
-    titleBg.setOutlineThickness(1.f);
+    sf::FloatRect face(x, y + hoverOffset, CARD_SIZE.x * hoverScale, CARD_SIZE.y * hoverScale);
+    auto regionIt = textureRegions.find(textureKeyFor(card));
+    if (regionIt != textureRegions.end()) {
+        appendQuad(batch, face, regionIt->second, sf::Color::White);
+    } else {
+        appendQuad(batch, face, atlas.getWhiteRegion(), sf::Color::Magenta);
+    }
 
-    
-    sf::RectangleShape artArea(sf::Vector2f(CARD_SIZE.x - 20, CARD_SIZE.y * 0.5f));
-    artArea.setPosition(x + 10, y + 40 + hoverOffset);
-    artArea.setFillColor(sf::Color(50, 50, 50));
-    artArea.setOutlineColor(sf::Color::Black);
-    artArea.setOutlineThickness(1.f);
+    auto colIt = factionColors.find(card.faction);
+    if (colIt != factionColors.end()) {
+        appendCardFrame(batch, face, 3.f, colIt->second);
+    } else {
+        appendCardFrame(batch, face, 2.f, sf::Color(255, 255, 255, 100));
+    }
     
     if (highlight) {
-        renderCardGlow(target, x, y + hoverOffset, sf::Color(255, 255, 100, 150));
+        appendGlow(batch, sf::Vector2f(x, y + hoverOffset), sf::Color(255, 255, 100, 150));
+    }
+
+    if (!batching) {
+        flushBatch(target);
     }
 }
 
 
 void CardRenderer::renderCardBack(sf::RenderTarget& target, float x, float y) {
-    sf::Sprite cardBack(cardBackTexture);
-    cardBack.setPosition(x, y);
-    cardBack.setScale(
-        CARD_SIZE.x / cardBack.getLocalBounds().width,
-        CARD_SIZE.y / cardBack.getLocalBounds().height
-    );
-    
-    target.draw(cardBack);
+    appendQuad(batch, sf::FloatRect(x, y, CARD_SIZE.x, CARD_SIZE.y), cardBackRegion, sf::Color::White);
+
+    if (!batching) {
+        flushBatch(target);
+    }
 }
 
 void CardRenderer::setupCardsText(sf::Text& text, const std::string& str, unsigned size, float x, float y) const {
@@ -211,83 +390,8 @@ void CardRenderer::setupCardsText(sf::Text& text, const std::string& str, unsign
     text.setPosition(x, y);
 }
 
-std::string CardRenderer::generateTooltipText(const Card& card) const {
-    std::stringstream tooltip;
-    
-    tooltip << "Name: " << card.getName() << "\n";
-    tooltip << "Faction: " << CardUtils::factionToString(card.getFaction()) << "\n";
-    tooltip << "Zone: " << CardUtils::zoneToString(card.getZone()) << "\n";
-
-    try {
-        switch(card.getType()) {
-            case CardType::UNIT: {
-                const UnitCard* unit = dynamic_cast<const UnitCard*>(&card);
-                if (unit) {
-                    tooltip << "Type: Unit Card\n";
-                    tooltip << "Power: " << unit->getPower() << "\n";
-                    if (unit->getDeployEffect() != DeployEffect::NONE) {
-                        tooltip << "Deploy: " 
-                              << CardUtils::getDeployEffectDescription(
-                                  unit->getDeployEffect(), 
-                                  unit->getEffectValue()
-                              ) << "\n";
-                    }
-                }
-                break;
-            }
-            
-            case CardType::HERO: {
-                const HeroCard* hero = dynamic_cast<const HeroCard*>(&card);
-                if (hero) {
-                    tooltip << "Type: Hero Card\n";
-                    tooltip << "Power: " << hero->getPower() << "\n";
-                    tooltip << "Ability: " 
-                    << CardUtils::getHeroAbilityDescription(
-                        hero->getAbility(),
-                        hero->getAbilityValue()
-                    ) << "\n";
-          }
-          break;
-      }
-            
-            case CardType::ABILITY: {
-                const AbilityCard* ability = dynamic_cast<const AbilityCard*>(&card);
-                if (ability) {
-                    tooltip << "Type: Ability Card\n";
-                    tooltip << "Effect: " 
-                          << CardUtils::getAbilityEffectDescription(
-                              ability->getEffect(),
-                              ability->getEffectValue()
-                          ) << "\n";
-                }
-                break;
-            }
-            
-            case CardType::WEATHER: {
-                const WeatherCard* weather = dynamic_cast<const WeatherCard*>(&card);
-                if (weather) {
-                    tooltip << "Type: Weather Card\n";
-                    tooltip << "Weather Effect: " 
-                          << CardUtils::weatherEffectDescription(weather->getWeatherType()) << "\n";
-                }
-                break;
-            }
-            
-            default:
-                tooltip << "Special card effect\n";
-        }
-    } catch (const std::bad_cast& e) {
-        tooltip << "\n[Error: Invalid card type conversion]";
-    }
-
-    if (!card.getDescription().empty()) {
-        tooltip << "\n" << card.getDescription();
-    }
-
-    return tooltip.str();
-}
-
 void CardRenderer::drawTooltip(sf::RenderTarget& target) const {
+    PROFILE_SCOPE("drawTooltip");
     sf::View originalView = target.getView();
     target.setView(target.getDefaultView());
         
@@ -297,26 +401,23 @@ void CardRenderer::drawTooltip(sf::RenderTarget& target) const {
 }
 
 
-void CardRenderer::updateHover(const sf::Vector2f& mousePos, 
-                             const std::vector<const Card*>& cards) {
-    hoveredCard = nullptr;
+void CardRenderer::updateHover(const sf::Vector2f& mousePos, const CardView* card) {
+    hoveredCard = card;
     
-    for (const Card* card : cards) {
-        if (card->getGlobalBounds().contains(mousePos)) {
-            hoveredCard = card;
-            tooltip.setText(generateTooltipText(*card));
-            tooltip.setPosition(mousePos.x + 15, mousePos.y + 15);
-            break;
+    if (card) {
+        if (!tooltip.restoreLayout(card->identity, card->version)) {
+            tooltip.setText(card->tooltip);
+            tooltip.storeLayout(card->identity, card->version);
         }
+        tooltip.setPosition(mousePos.x + 15, mousePos.y + 15);
     }
     tooltip.show(hoveredCard != nullptr);
 }
 
 void CardRenderer::renderCardHoverEffect(sf::RenderTarget& target, float x, float y) const {
-    sf::RectangleShape shadow(CARD_SIZE);
-    shadow.setPosition(x + 5, y + 10);
-    shadow.setFillColor(sf::Color(0, 0, 0, 50));
-    renderRoundedRectangle(target, shadow.getGlobalBounds(), CARD_CORNER_RADIUS, shadow.getFillColor());
+    sf::VertexArray shadow(sf::Triangles);
+    appendShadow(shadow, sf::FloatRect(x + 5, y + 10, CARD_SIZE.x, CARD_SIZE.y), sf::Color(0, 0, 0, 50));
+    target.draw(shadow, sf::RenderStates(&atlas.getTexture()));
     
     sf::ConvexShape highlight(4);
     highlight.setPoint(0, sf::Vector2f(x, y + CARD_SIZE.y * 0.7f));
@@ -327,42 +428,93 @@ void CardRenderer::renderCardHoverEffect(sf::RenderTarget& target, float x, floa
     target.draw(highlight);
 }
 
- void CardRenderer::renderRoundedRectangle(sf::RenderTarget& target, const sf::FloatRect& rect, 
+void CardRenderer::renderRoundedRectangle(sf::RenderTarget& target, const sf::FloatRect& rect, 
                                         float radius, const sf::Color& fillColor, 
                                         float outlineThickness, const sf::Color& outlineColor) const {
-    sf::CircleShape corner(radius);
-    corner.setPointCount(32);
-    corner.setFillColor(fillColor);
-    corner.setOutlineThickness(outlineThickness);
-    corner.setOutlineColor(outlineColor);
-    
-    sf::RectangleShape center(sf::Vector2f(rect.width - 2 * radius, rect.height));
-    center.setPosition(rect.left + radius, rect.top);
-    center.setFillColor(fillColor);
-    center.setOutlineThickness(outlineThickness);
-    center.setOutlineColor(outlineColor);
-    target.draw(center);
-    
-    sf::RectangleShape left(sf::Vector2f(rect.width, rect.height - 2 * radius));
-    left.setPosition(rect.left, rect.top + radius);
-    left.setFillColor(fillColor);
-    left.setOutlineThickness(outlineThickness);
-    left.setOutlineColor(outlineColor);
-    target.draw(left);
-    
-    corner.setPosition(rect.left, rect.top);
-    target.draw(corner);
-    
-    corner.setPosition(rect.left + rect.width - 2 * radius, rect.top);
-    target.draw(corner);
-    
-    corner.setPosition(rect.left, rect.top + rect.height - 2 * radius);
-    target.draw(corner);
-    
-    corner.setPosition(rect.left + rect.width - 2 * radius, 
-                      rect.top + rect.height - 2 * radius);
-    target.draw(corner);
- }
+    sf::VertexArray vertices(sf::Triangles);
+    if (outlineThickness > 0.f) {
+        appendRoundedRectangle(vertices,
+            sf::FloatRect(rect.left - outlineThickness, rect.top - outlineThickness,
+                          rect.width + 2 * outlineThickness, rect.height + 2 * outlineThickness),
+            radius + outlineThickness, outlineColor);
+    }
+    appendRoundedRectangle(vertices, rect, radius, fillColor);
+    target.draw(vertices, sf::RenderStates(&atlas.getTexture()));
+}
+
+void CardRenderer::appendQuad(sf::VertexArray& vertices, const sf::FloatRect& rect,
+                              const sf::IntRect& texRect, const sf::Color& color) const {
+    const float left = static_cast<float>(texRect.left);
+    const float top = static_cast<float>(texRect.top);
+    const float right = left + texRect.width;
+    const float bottom = top + texRect.height;
+
+    sf::Vertex topLeft(sf::Vector2f(rect.left, rect.top), color, sf::Vector2f(left, top));
+    sf::Vertex topRight(sf::Vector2f(rect.left + rect.width, rect.top), color, sf::Vector2f(right, top));
+    sf::Vertex bottomRight(sf::Vector2f(rect.left + rect.width, rect.top + rect.height), color, sf::Vector2f(right, bottom));
+    sf::Vertex bottomLeft(sf::Vector2f(rect.left, rect.top + rect.height), color, sf::Vector2f(left, bottom));
+
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+    vertices.append(topLeft);
+    vertices.append(bottomRight);
+    vertices.append(bottomLeft);
+}
+
+void CardRenderer::appendFrame(sf::VertexArray& vertices, const sf::FloatRect& rect,
+                               float thickness, const sf::Color& color) const {
+    const sf::IntRect white = atlas.getWhiteRegion();
+    const float outerWidth = rect.width + 2 * thickness;
+
+    appendQuad(vertices, sf::FloatRect(rect.left - thickness, rect.top - thickness, outerWidth, thickness), white, color);
+    appendQuad(vertices, sf::FloatRect(rect.left - thickness, rect.top + rect.height, outerWidth, thickness), white, color);
+    appendQuad(vertices, sf::FloatRect(rect.left - thickness, rect.top, thickness, rect.height), white, color);
+    appendQuad(vertices, sf::FloatRect(rect.left + rect.width, rect.top, thickness, rect.height), white, color);
+}
+
+void CardRenderer::appendCircle(sf::VertexArray& vertices, const sf::Vector2f& center, float radius,
+                                int points, const sf::Color& color) const {
+    const sf::IntRect white = atlas.getWhiteRegion();
+    const sf::Vector2f texCoord(white.left + 1.f, white.top + 1.f);
+    const float step = 2.f * 3.14159265f / points;
+
+    for (int i = 0; i < points; ++i) {
+        float a0 = i * step;
+        float a1 = (i + 1) * step;
+        vertices.append(sf::Vertex(center, color, texCoord));
+        vertices.append(sf::Vertex(center + sf::Vector2f(std::cos(a0) * radius, std::sin(a0) * radius), color, texCoord));
+        vertices.append(sf::Vertex(center + sf::Vector2f(std::cos(a1) * radius, std::sin(a1) * radius), color, texCoord));
+    }
+}
+
+void CardRenderer::appendRoundedRectangle(sf::VertexArray& vertices, const sf::FloatRect& rect,
+                                          float radius, const sf::Color& color) const {
+    const sf::IntRect white = atlas.getWhiteRegion();
+    const sf::Vector2f texCoord(white.left + 1.f, white.top + 1.f);
+    const int cornerSegments = 8;
+    const float quarter = 3.14159265f / 2.f;
+
+    appendQuad(vertices, sf::FloatRect(rect.left + radius, rect.top, rect.width - 2 * radius, rect.height), white, color);
+    appendQuad(vertices, sf::FloatRect(rect.left, rect.top + radius, radius, rect.height - 2 * radius), white, color);
+    appendQuad(vertices, sf::FloatRect(rect.left + rect.width - radius, rect.top + radius, radius, rect.height - 2 * radius), white, color);
+
+    const sf::Vector2f centers[4] = {
+        {rect.left + rect.width - radius, rect.top + rect.height - radius},
+        {rect.left + radius, rect.top + rect.height - radius},
+        {rect.left + radius, rect.top + radius},
+        {rect.left + rect.width - radius, rect.top + radius}
+    };
+    for (int corner = 0; corner < 4; ++corner) {
+        for (int i = 0; i < cornerSegments; ++i) {
+            float a0 = corner * quarter + i * quarter / cornerSegments;
+            float a1 = corner * quarter + (i + 1) * quarter / cornerSegments;
+            vertices.append(sf::Vertex(centers[corner], color, texCoord));
+            vertices.append(sf::Vertex(centers[corner] + sf::Vector2f(std::cos(a0) * radius, std::sin(a0) * radius), color, texCoord));
+            vertices.append(sf::Vertex(centers[corner] + sf::Vector2f(std::cos(a1) * radius, std::sin(a1) * radius), color, texCoord));
+        }
+    }
+}
 
 void CardRenderer::setupCardText(sf::Text& text,
                                 const std::string& str,
@@ -397,11 +549,7 @@ void CardRenderer::renderCardGlow(sf::RenderTarget& target,
                                  float y,
                                  const sf::Color& color) const 
 {
-    const float glowRadius = 25.f;
-    const int points = 16;
-    
-    sf::CircleShape glow(glowRadius, points);
-    glow.setPosition(x - glowRadius, y - glowRadius);
-    glow.setFillColor(color);
-    target.draw(glow);
+    sf::VertexArray glow(sf::Triangles);
+    appendGlow(glow, sf::Vector2f(x, y), color);
+    target.draw(glow, sf::RenderStates(&atlas.getTexture()));
 }
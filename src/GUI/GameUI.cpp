@@ -1,8 +1,9 @@
 #include <iostream>
 #include "GUI/GameUI.h"
+#include "Utils/Profiler.h"
 
-GameUI::GameUI(Game& game, CardRenderer& renderer, const sf::Font& font) 
-    : game(game), cardRenderer(renderer), font(font) {
+GameUI::GameUI(GameLogicThread& logic, CardRenderer& renderer, const CardLayout& layout, const sf::Font& font) 
+    : logic(logic), cardRenderer(renderer), cardLayout(layout), font(font) {
     messageText.setFont(font);
     messageText.setCharacterSize(20);
     messageText.setFillColor(sf::Color::White);
@@ -21,32 +22,23 @@ void GameUI::handleEvent(const sf::Event& event, const sf::RenderWindow& window)
     
     if (event.type == sf::Event::MouseButtonReleased && 
         event.mouseButton.button == sf::Mouse::Left) {
-        const Player& currentPlayer = game.getCurrentPlayer();
+        const PlayerView& currentPlayer = logic.snapshot().current();
         sf::Vector2f mousePos = window.mapPixelToCoords(sf::Vector2i(
             event.mouseButton.x, event.mouseButton.y));
         
         int clickedIndex = -1;
         if (isCardClicked(mousePos, currentPlayer, clickedIndex, window)) {
-            if (currentPlayer.getSelectedCardIndex() == clickedIndex) {
-                try {
-                    game.playCard(currentPlayer.getPlayerId(), clickedIndex);
-                    const_cast<Player&>(currentPlayer).deselectCard();
-                } catch (const std::exception& e) {
-                    showMessage(e.what());
-                }
-            } else {
-                const_cast<Player&>(currentPlayer).selectCard(clickedIndex);
-            }
+            logic.post({GameCommand::Type::CLICK_CARD, currentPlayer.id, clickedIndex});
         } else {
-            const_cast<Player&>(currentPlayer).deselectCard();
+            logic.post({GameCommand::Type::DESELECT_CARD, currentPlayer.id});
         }
     }
     
 }
 
-void GameUI::update(const sf::RenderWindow& window) {
+void GameUI::update(const sf::RenderWindow& window, float deltaTime) {
     if (messageTimer > 0) {
-        messageTimer -= 1.0f/60.0f; 
+        messageTimer -= deltaTime; 
         if (messageTimer <= 0) {
             messageTimer = 0;
             messageText.setString("");
@@ -60,7 +52,12 @@ void GameUI::update(const sf::RenderWindow& window) {
     
 }
 
+bool GameUI::isAnimating() const {
+    return messageTimer > 0;
+}
+
 void GameUI::render(sf::RenderWindow& window) {
+    PROFILE_SCOPE("GameUI::render");
     if (messageTimer > 0) {
         messageBackground.setSize(sf::Vector2f(
             messageText.getLocalBounds().width + 40,
@@ -78,7 +75,7 @@ void GameUI::render(sf::RenderWindow& window) {
         button.draw(window);
     }
     
-    renderSelectedCardHighlight(window, game.getCurrentPlayer());
+    renderSelectedCardHighlight(window, logic.snapshot().current());
 }
 
 void GameUI::showMessage(const std::string& message, float duration) {
@@ -87,16 +84,12 @@ void GameUI::showMessage(const std::string& message, float duration) {
 }
 
 void GameUI::onPassClicked() {
-    try {
-        game.pass(game.getCurrentPlayer().getPlayerId());
-        showMessage("You passed this round");
-    } catch (const std::exception& e) {
-        showMessage(e.what());
-    }
+    logic.post({GameCommand::Type::PASS, logic.snapshot().currentPlayer});
+    showMessage("You passed this round");
 }
 
 void GameUI::onEndTurnClicked() {
-    game.endTurn();
+    logic.post({GameCommand::Type::END_TURN, logic.snapshot().currentPlayer});
     showMessage("Turn ended");
 }
 
@@ -104,47 +97,24 @@ void GameUI::onHelpClicked() {
     showMessage("Gwent Help:\n- Click cards to select\n- Click again to play\n- Pass to end your round\n- Hero cards have special abilities", 5.0f);
 }
 
-bool GameUI::isCardClicked(const sf::Vector2f& mousePos, const Player& player, 
+bool GameUI::isCardClicked(const sf::Vector2f& mousePos, const PlayerView& player, 
                           int& clickedIndex, const sf::RenderWindow& window) const {
-    const auto& hand = player.getHand();
-    if (hand.empty()) return false;
-    
-    float cardWidth = cardRenderer.getCardSize().x;
-    float cardHeight = cardRenderer.getCardSize().y;
-    float spacing = 10.f;
-    float totalWidth = hand.size() * cardWidth + (hand.size() - 1) * spacing;
-    float startX = (window.getSize().x - totalWidth) / 2;
-    float y = window.getSize().y - cardHeight - 20;
-    
-    for (size_t i = 0; i < hand.size(); ++i) {
-        sf::FloatRect cardRect(
-            startX + i * (cardWidth + spacing),
-            y,
-            cardWidth,
-            cardHeight
-        );
-        
-        if (cardRect.contains(mousePos)) {
-            clickedIndex = static_cast<int>(i);
-            return true;
-        }
+    const CardLayout::Slot* slot = cardLayout.hitTest(mousePos);
+    if (slot && slot->inHand && slot->playerId == player.id) {
+        clickedIndex = slot->index;
+        return true;
     }
     return false;
 }
 
-void GameUI::renderSelectedCardHighlight(sf::RenderWindow& window, const Player& player) const {
-    int selectedIndex = player.getSelectedCardIndex();
-    if (selectedIndex < 0 || selectedIndex >= player.getHand().size()) return;
+void GameUI::renderSelectedCardHighlight(sf::RenderWindow& window, const PlayerView& player) const {
+    int selectedIndex = player.selectedIndex;
+    if (selectedIndex < 0 || selectedIndex >= static_cast<int>(player.hand.size())) return;
     
-    float cardWidth = cardRenderer.getCardSize().x;
-    float cardHeight = cardRenderer.getCardSize().y;
-    float spacing = 10.f;
-    float totalWidth = player.getHand().size() * cardWidth + (player.getHand().size() - 1) * spacing;
-    float startX = (window.getSize().x - totalWidth) / 2;
-    float y = window.getSize().y - cardHeight - 20;
+    sf::FloatRect cardRect = cardLayout.handCardRect(player.hand.size(), selectedIndex);
     
-    sf::RectangleShape highlight(sf::Vector2f(cardWidth + 10, cardHeight + 10));
-    highlight.setPosition(startX + selectedIndex * (cardWidth + spacing) - 5, y - 5);
+    sf::RectangleShape highlight(sf::Vector2f(cardRect.width + 10, cardRect.height + 10));
+    highlight.setPosition(cardRect.left - 5, cardRect.top - 5);
     highlight.setFillColor(sf::Color::Transparent);
     highlight.setOutlineColor(sf::Color::Yellow);
     highlight.setOutlineThickness(3.f);
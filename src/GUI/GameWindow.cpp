@@ -1,17 +1,25 @@
 #include "../GUI/GameWindow.h"
 #include "../GUI/GameUI.h"
+#include "../include/Core/Game.h"
+#include "../include/Utils/FixedString.h"
+#include "../include/Utils/Profiler.h"
 #include <string>
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 
 GameWindow::GameWindow(const std::string& p1, const std::string& p2) 
     : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Gwent", sf::Style::Default),
-      game(std::make_unique<Game>(p1, p2)),
       font(),
       gameUI(nullptr),
       currentPlayerIndex(0),
+      cardLayout(CardRenderer::CARD_SIZE, CARD_SPACING),
       mainMenu(font,sf::Vector2f(30, 30)),
-      helpPanel(font, window)
+      helpPanel(font, window),
+      textCache(font),
+      profilerOverlay(font, sf::Vector2f(WINDOW_WIDTH - 380.f, 90.f))
 {
     window.setVerticalSyncEnabled(true);
     try {
@@ -22,25 +30,46 @@ GameWindow::GameWindow(const std::string& p1, const std::string& p2)
             throw std::runtime_error("Font load failed");
         }
         std::cout << "3. Font loaded successfully\n";
-        cardRenderer = std::make_unique<CardRenderer>(font, window);
+        cardRenderer = std::make_unique<CardRenderer>(font, window, assets);
+        if (const char* tier = std::getenv("GWENT_TEXTURE_TIER")) {
+            cardRenderer->setTextureTier(CardRenderer::parseTextureTier(tier));
+        }
         std::cout << "3.5.Rednered successfully\n";
 
+        AssetLoader assetLoader;
+        cardRenderer->queueResources(assetLoader);
+        assetLoader.start();
+
         std::cout << "4. Creating game instance...\n";
+        auto game = std::make_unique<Game>(p1, p2);
         std::cout << "5. Game instance created\n";
 
-        std::cout << "6. Initializing GameUI...\n";
-        gameUI = std::make_unique<GameUI>(*game, *cardRenderer, font);
-        std::cout << "7. GameUI initialized\n";
-
-        std::cout << "8. Loading deck...\n";
+        std::cout << "6. Loading deck...\n";
         game->loadDeck("../assets/cards.json");
-        std::cout << "9. Deck loaded\n";
+        std::cout << "7. Deck loaded\n";
 
-        std::cout << "10. Starting game...\n";
+        std::cout << "8. Starting game...\n";
         game->startGame();
-        std::cout << "11. Game started successfully\n";
+        logic = std::make_unique<GameLogicThread>(std::move(game));
+        logic->start();
+        std::cout << "9. Game started successfully\n";
+
+        std::cout << "10. Initializing GameUI...\n";
+        gameUI = std::make_unique<GameUI>(*logic, *cardRenderer, cardLayout, font);
+        std::cout << "11. GameUI initialized\n";
+
+        while (!assetLoader.isDone() && window.isOpen()) {
+            sf::Event event;
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed) {
+                    window.close();
+                }
+            }
+            renderLoadingScreen(assetLoader.getProgress());
+        }
+        assetLoader.wait();
 
-        if (!cardRenderer->loadResources()) {
+        if (!cardRenderer->finishLoading(assetLoader)) {
             throw std::runtime_error("Card renderer initialization failed");
         }
 
@@ -50,7 +79,7 @@ GameWindow::GameWindow(const std::string& p1, const std::string& p2)
         throw;
     }    
     mainMenu.addOption("Pass", [this]() { 
-        game->pass(game->getCurrentPlayerIndex());
+        logic->post({GameCommand::Type::PASS, state().currentPlayer});
     });
     mainMenu.addOption("Help", [this]() { 
         helpPanel.toggle();
@@ -59,6 +88,11 @@ GameWindow::GameWindow(const std::string& p1, const std::string& p2)
         window.close();
     });
     mainMenu.setSize({120, 30});
+
+    frameStatsText.setFont(font);
+    frameStatsText.setCharacterSize(14);
+    frameStatsText.setFillColor(sf::Color(200, 255, 200));
+    frameStatsText.setPosition(WINDOW_WIDTH - 480.f, WINDOW_HEIGHT - 45.f);
 }
 
 void GameWindow::run() {
@@ -66,16 +100,30 @@ void GameWindow::run() {
 
     sf::Clock frameClock;
     while (window.isOpen()) {
+        if (eventDriven && !isAnimating()) {
+            // Nothing on screen can change until input arrives, so block
+            // instead of redrawing an identical frame.
+            sf::Event event;
+            if (!window.waitEvent(event)) break;
+            acquireState();
+            handleEvent(event);
+            frameClock.restart();
+        }
+
+        PROFILE_FRAME();
         sf::Time deltaTime = frameClock.restart();
         float deltaSeconds = deltaTime.asSeconds();
+        updateFrameStats(deltaSeconds);
+        profilerOverlay.update(deltaSeconds);
         deltaSeconds = std::min(deltaSeconds, 0.1f);
 
+        acquireState();
         processEvents();
 
         if (!gameOverTriggered) {
             update(deltaSeconds);
             
-            if (game->isGameOver()) {
+            if (state().gameOver) {
                 gameOverTriggered = true;
                 gameOverClock.restart();
             }
@@ -92,11 +140,39 @@ void GameWindow::run() {
                 window.close();
             }
         }
+        PROFILE_FRAME_END();
     }
     window.display();
+    logic->stop();
 
 }
 
+void GameWindow::renderLoadingScreen(float progress) {
+    const sf::Vector2f barSize(WINDOW_WIDTH * 0.4f, 24.f);
+    const sf::Vector2f barPos((WINDOW_WIDTH - barSize.x) / 2, WINDOW_HEIGHT / 2.f);
+
+    sf::RectangleShape frame(barSize);
+    frame.setPosition(barPos);
+    frame.setFillColor(sf::Color(0, 0, 0, 180));
+    frame.setOutlineColor(sf::Color(150, 150, 150));
+    frame.setOutlineThickness(2.f);
+
+    sf::RectangleShape fill(sf::Vector2f(barSize.x * std::clamp(progress, 0.f, 1.f), barSize.y));
+    fill.setPosition(barPos);
+    fill.setFillColor(sf::Color(255, 215, 0));
+
+    char label[32];
+    std::snprintf(label, sizeof(label), "Loading cards... %d%%", static_cast<int>(progress * 100.f));
+    sf::Text text(label, font, 20);
+    text.setPosition(barPos.x, barPos.y - 35.f);
+
+    window.clear(sf::Color(30, 22, 16));
+    window.draw(frame);
+    window.draw(fill);
+    window.draw(text);
+    window.display();
+}
+
 void GameWindow::renderGameOverMessage() {
     sf::RectangleShape overlay(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
     overlay.setFillColor(sf::Color(0, 0, 0, 200));
@@ -107,7 +183,7 @@ void GameWindow::renderGameOverMessage() {
     victoryText.setCharacterSize(40);
     victoryText.setFillColor(sf::Color::Yellow);
     victoryText.setStyle(sf::Text::Bold);
-    victoryText.setString(game->getWinnerName() + " Wins!\nClosing in 3 seconds...");
+    victoryText.setString(getWinnerName() + " Wins!\nClosing in 3 seconds...");
     
     sf::FloatRect textBounds = victoryText.getLocalBounds();
     victoryText.setOrigin(textBounds.width/2, textBounds.height/2);
@@ -116,204 +192,242 @@ void GameWindow::renderGameOverMessage() {
     window.draw(victoryText);
 }
 
-sf::FloatRect GameWindow::getHandCardPosition(const Player& player, int index) const {
-    const auto& hand = player.getHand();
-    if (hand.empty() || index < 0 || index >= hand.size()) return {};
+sf::FloatRect GameWindow::getHandCardPosition(const PlayerView& player, int index) const {
+    const auto& hand = player.hand;
+    if (hand.empty() || index < 0 || index >= static_cast<int>(hand.size())) return {};
     
-    const float cardWidth = cardRenderer->getCardSize().x;
-    const float cardHeight = cardRenderer->getCardSize().y;
-    const float spacing = 10.f;
-    const float totalWidth = hand.size() * cardWidth + (hand.size() - 1) * spacing;
-    const float startX = (window.getSize().x - totalWidth) / 2;
-    const float y = window.getSize().y - cardHeight - 20;
-    
-    return {
-        startX + index * (cardWidth + spacing),
-        y,
-        cardWidth,
-        cardHeight
-    };
+    return cardLayout.handCardRect(hand.size(), index);
+}
+
+const GameSnapshot& GameWindow::state() const {
+    return logic->snapshot();
+}
+
+// Switches to the newest state published by the logic thread. Everything
+// drawn or hit-tested until the next call reads this one snapshot.
+void GameWindow::acquireState() {
+    if (!logic->acquireSnapshot()) return;
+
+    refreshLayout();
+    syncPlayerIndex();
+    const GameSnapshot& snapshot = state();
+    if (snapshot.messageId != shownMessageId) {
+        shownMessageId = snapshot.messageId;
+        gameUI->showMessage(snapshot.message);
+    }
+}
+
+void GameWindow::refreshLayout() {
+    if (cardLayout.needsRebuild(state(), window.getSize())) {
+        cardLayout.rebuild(state(), window.getSize());
+    }
 }
 
 void GameWindow::processEvents() {
+    PROFILE_SCOPE("processEvents");
+    refreshLayout();
     sf::Event event;
     while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed) {
-            window.close();
-        }
-        sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-        if (event.type == sf::Event::MouseButtonReleased && 
-            event.mouseButton.button == sf::Mouse::Left) 
-        {
-            mainMenu.handleClick(mousePos);
-        }
+        handleEvent(event);
+    }
+}
+
+void GameWindow::handleEvent(const sf::Event& event) {
+    if (event.type == sf::Event::Closed) {
+        window.close();
+    }
+    sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+    if (event.type == sf::Event::MouseButtonReleased && 
+        event.mouseButton.button == sf::Mouse::Left) 
+    {
+        mainMenu.handleClick(mousePos);
+    }
 
-        if (event.type == sf::Event::Closed) {
-            window.close();
+    if (event.type == sf::Event::Closed) {
+        window.close();
+    }
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+        showFrameStats = !showFrameStats;
+        profilerOverlay.toggle();
+    }
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5) {
+        eventDriven = !eventDriven;
+        std::cout << (eventDriven ? "Idle throttling on\n" : "Idle throttling off\n");
+    }
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+        if (Profiler::instance().dumpChromeTrace("gwent_trace.json")) {
+            std::cout << "Wrote profiler trace to gwent_trace.json\n";
         }
-        mainMenu.update(mousePos);
+    }
+    mainMenu.update(mousePos);
 
-        
+    
 
-        if (event.type == sf::Event::MouseButtonReleased && 
-            event.mouseButton.button == sf::Mouse::Left) 
-        {
-            sf::Vector2f mousePos = window.mapPixelToCoords(
-                {event.mouseButton.x, event.mouseButton.y},
-                window.getDefaultView()
-            );
+    if (event.type == sf::Event::MouseButtonReleased && 
+        event.mouseButton.button == sf::Mouse::Left) 
+    {
+        sf::Vector2f mousePos = window.mapPixelToCoords(
+            {event.mouseButton.x, event.mouseButton.y},
+            window.getDefaultView()
+        );
 
-            handleCardSelection(mousePos);
+        handleCardSelection(mousePos);
 
-            Player& currentPlayer = game->getCurrentPlayer();
-            const int playerId = currentPlayer.getPlayerId();
-            
-            const float cardWidth = cardRenderer->getCardSize().x;
-            const float cardHeight = cardRenderer->getCardSize().y;
-            const float spacing = 10.f;
-            const float centerY = window.getSize().y / 2.f;
-            const float zoneHeight = cardHeight + 35.f;
-
-            for (int zoneIdx = 0; zoneIdx < 3; zoneIdx++) {
-                CombatZone zone = static_cast<CombatZone>(zoneIdx);
-                auto& cards = game->getBoard().getPlayerZone(playerId, zone);
-
-                float zoneY = centerY - 200.f + zoneIdx * (zoneHeight + 15.f);
-                float startX = (playerId == 0) ? 60.f : window.getSize().x/2.f + 10.f;
-                float startY = zoneY + 30.f;
-
-                for (size_t i = 0; i < cards.size(); ++i) {
-                    sf::FloatRect cardRect(
-                        startX + i * (cardWidth + spacing),
-                        startY,
-                        cardWidth,
-                        cardHeight
-                    );
-
-                    if (cardRect.contains(mousePos)) {
-                        if (auto* hero = dynamic_cast<HeroCard*>(cards[i].get())) {
-                            if (currentPlayer.canUseHeroAbility(hero->getName())) {
-                                try {
-                                    hero->activateAbility(currentPlayer, 
-                                                        game->getOpponent(), 
-                                                        game->getBoard());
-                                    currentPlayer.markHeroAbilityUsed(hero->getName());
-                                } catch (const std::exception& e) {
-                                }
-                            } else {
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        const int playerId = state().currentPlayer;
+        const CardLayout::Slot* slot = cardLayout.hitTest(mousePos);
 
-        cardRenderer->updateHover(mousePos, getAllVisibleCards());
+        if (slot && !slot->inHand && slot->playerId == playerId && slot->card->type == CardType::HERO) {
+            logic->post({GameCommand::Type::ACTIVATE_HERO, playerId, slot->index, slot->zone});
+        }
     }
+
+    updateHoverState();
 }
 
 void GameWindow::handleCardSelection(const sf::Vector2f& mousePos) {
-    Player& currentPlayer = game->getCurrentPlayer();
-    const auto& hand = currentPlayer.getHand();
-    
-    const float cardWidth = cardRenderer->getCardSize().x;
-    const float cardHeight = cardRenderer->getCardSize().y;
-    const float spacing = 10.f;
-    const float totalWidth = hand.size() * cardWidth + (hand.size() - 1) * spacing;
-    const float startX = (window.getSize().x - totalWidth) / 2;
-    const float yPos = window.getSize().y - cardHeight - 20;
-
-    for (size_t i = 0; i < hand.size(); ++i) {
-        sf::FloatRect cardRect(
-            startX + i * (cardWidth + spacing),
-            yPos,
-            cardWidth,
-            cardHeight
-        );
-
-        if (cardRect.contains(mousePos)) {
-            const int selectedIndex = currentPlayer.getSelectedCardIndex();
-            
-            if (selectedIndex == static_cast<int>(i)) {
-                try {
-                    game->playCard(currentPlayer.getPlayerId(), i);
-                    currentPlayer.deselectCard();
-                } catch (const std::exception& e) {
-                }
-            } else {
-                currentPlayer.selectCard(i);
-            }
-            return;
-        }
+    const PlayerView& currentPlayer = state().current();
+    const CardLayout::Slot* slot = cardLayout.hitTest(mousePos);
+
+    // The snapshot may be a frame behind, so a quick second click could
+    // still show the card unselected; the logic thread decides instead.
+    if (slot && slot->inHand) {
+        logic->post({GameCommand::Type::CLICK_CARD, currentPlayer.id, slot->index});
+        return;
     }
     
-    currentPlayer.deselectCard();
+    logic->post({GameCommand::Type::DESELECT_CARD, currentPlayer.id});
 }
 
 void GameWindow::update(float deltaTime) {
-    sf::Vector2f mousePos = window.mapPixelToCoords(
-        sf::Mouse::getPosition(window),
-        window.getDefaultView()
-    );
-    cardRenderer->updateHover(mousePos, getAllVisibleCards());
-    
-    game->update(deltaTime);
+    PROFILE_SCOPE("update");
+    updateHoverState();
+    gameUI->update(window, deltaTime);
+}
+
+bool GameWindow::isAnimating() const {
+    return !animatedCards.empty() ||
+           gameOverTriggered ||
+           gameUI->isAnimating() ||
+           logic->hasPendingCommands() ||
+           profilerOverlay.isVisible() ||
+           sceneNeedsRebuild();
 }
 
 void GameWindow::render() {
+    PROFILE_SCOPE("render");
     window.clear(sf::Color(30, 22, 16));
-    window.draw(background);
-    
-    const int currentIdx = game->getCurrentPlayerIndex();
 
-    renderGameBoard();
-    
-    renderPlayerHand(game->getPlayer(currentIdx), true); 
+    if (sceneNeedsRebuild()) {
+        rebuildScene();
+    }
+    window.draw(scene);
 
-    renderPlayerInfo();
+    if (!animatedCards.empty()) {
+        cardRenderer->beginBatch();
+        for (const auto& animated : animatedCards) {
+            cardRenderer->renderCard(window, *animated.card, animated.x, animated.y, true, true);
+        }
+        cardRenderer->flushBatch(window);
+    }
 
     cardRenderer->drawTooltip(window);
     gameUI->render(window);
     mainMenu.draw(window);
     helpPanel.draw(window);
+    if (showFrameStats) {
+        window.draw(frameStatsText);
+    }
+    profilerOverlay.draw(window);
     window.display();
 }
 
+bool GameWindow::sceneNeedsRebuild() const {
+    return !sceneBuilt ||
+           sceneVersion != state().sequence ||
+           sceneSize != window.getSize() ||
+           sceneSelectedIndex != state().current().selectedIndex;
+}
+
+// Everything that only changes when a card is played is captured once here;
+// only selected (pulsing) cards are left for the per-frame pass.
+void GameWindow::rebuildScene() {
+    PROFILE_SCOPE("rebuildScene");
+    scene.clear();
+    textCache.collect();
+    animatedCards.clear();
+    scene.setCardTexture(&cardRenderer->getAtlasTexture());
+    scene.add(background);
+
+    cardRenderer->beginBatch();
+    renderGameBoard();
+    renderPlayerHand(state().current(), true);
+    cardRenderer->endBatch(scene.getCardVertices());
+
+    sceneSize = window.getSize();
+    if (!scene.bake(sceneSize, sf::Color(30, 22, 16))) {
+        std::cerr << "Board layer caching unavailable, drawing scene directly\n";
+    }
+
+    sceneVersion = state().sequence;
+    sceneSelectedIndex = state().current().selectedIndex;
+    sceneBuilt = true;
+    ++sceneRebuilds;
+}
+
+void GameWindow::updateFrameStats(float frameSeconds) {
+    frameTimeAccumulator += frameSeconds;
+    frameTimeWorst = std::max(frameTimeWorst, frameSeconds);
+    ++framesSinceStats;
+
+    if (frameTimeAccumulator < 0.5f) return;
+
+    float averageMs = frameTimeAccumulator * 1000.f / framesSinceStats;
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "Frame %.2f ms (worst %.2f) | %.0f fps | scene rebuilds %u | text layouts %u\n"
+                  "Textures %zu, %.1f / %.0f MiB",
+                  averageMs, frameTimeWorst * 1000.f,
+                  framesSinceStats / frameTimeAccumulator, sceneRebuilds,
+                  textCache.getLayoutCount(), assets.getLoadedCount(),
+                  assets.getTextureMemory() / 1048576.f, assets.getBudget() / 1048576.f);
+    frameStatsText.setString(buffer);
+
+    frameTimeAccumulator = 0.f;
+    frameTimeWorst = 0.f;
+    framesSinceStats = 0;
+}
+
 std::string GameWindow::getWinnerName() const {
-    if (!game) {
+    if (!logic) {
         return "Game not initialized";
     }
     
-    const Player& p1 = game->getPlayer(0);
-    const Player& p2 = game->getPlayer(1);
+    const PlayerView& p1 = state().players[0];
+    const PlayerView& p2 = state().players[1];
     
-    if (p1.getRoundsWon() > p2.getRoundsWon()) {
-        return p1.getName();
-    } else if (p2.getRoundsWon() > p1.getRoundsWon()) {
-        return p2.getName();
+    if (p1.roundsWon > p2.roundsWon) {
+        return p1.name;
+    } else if (p2.roundsWon > p1.roundsWon) {
+        return p2.name;
     }
     return "Draw";
 }
 
 void GameWindow::updateUIState() 
 {
-        const Player& currentPlayer = game->getCurrentPlayer();
+        const PlayerView& currentPlayer = state().current();
 }
 
 
 void GameWindow::loadResources() {
-    if (!font.loadFromFile("../assets/fonts/times.ttf")) {
-        std::cerr << "ERROR: Failed to load font from: assets/fonts/myfont.ttf\n";
-        return; 
-    }
-    
-    if (!backgroundTexture.loadFromFile("../assets/cards/background.jpg")) {
+    backgroundTexture = assets.texture("../assets/cards/background.jpg");
+    if (!backgroundTexture.get().getSize().x) {
         throw std::runtime_error("Failed to load background");
     }
-    background.setTexture(backgroundTexture);
+    background.setTexture(backgroundTexture.get());
 
     sf::Vector2u windowSize = window.getSize();
-    sf::Vector2u texSize = backgroundTexture.getSize();
+    sf::Vector2u texSize = backgroundTexture.get().getSize();
     float scaleX = static_cast<float>(windowSize.x) / texSize.x;
     float scaleY = static_cast<float>(windowSize.y) / texSize.y;
     background.setScale(scaleX, scaleY);
@@ -326,15 +440,15 @@ void GameWindow::loadResources() {
 void GameWindow::renderTurnGlow() {
     float glow = sin(pulseClock.getElapsedTime().asSeconds() * 5) * 0.5f + 0.5f;
     sf::RectangleShape glowBar(sf::Vector2f(WINDOW_WIDTH, 3));
-    glowBar.setPosition(0, game->getCurrentPlayer().getPlayerId() == 0 ? 95 : WINDOW_HEIGHT - 98);
+    glowBar.setPosition(0, state().currentPlayer == 0 ? 95 : WINDOW_HEIGHT - 98);
     glowBar.setFillColor(sf::Color(255, 255, 0, static_cast<sf::Uint8>(glow * 200)));
     window.draw(glowBar);
 }
 
 void GameWindow::loadZoneAssets() {
-    zoneBackgrounds[0].loadFromFile("../assets/zones/close_combat.png");
-    zoneBackgrounds[1].loadFromFile("../assets/zones/ranged_combat.png");
-    zoneBackgrounds[2].loadFromFile("../assets/zones/siege_combat.png");
+    zoneBackgrounds[0] = assets.texture("../assets/zones/close_combat.png");
+    zoneBackgrounds[1] = assets.texture("../assets/zones/ranged_combat.png");
+    zoneBackgrounds[2] = assets.texture("../assets/zones/siege_combat.png");
     
 }
 
@@ -343,97 +457,74 @@ void GameWindow::renderZoneScores() {
     const float zoneHeight = cardRenderer->getCardSize().y;
     
     for (int i = 0; i < 3; i++) {
-        CombatZone zone = static_cast<CombatZone>(i);
+        const float y = centerY - zoneHeight - 15 + i*(zoneHeight+40);
         
-        int p1Power = game->getBoard().getPlayerPower(0, zone);
-        zonePowerTexts[i][0].setString(std::to_string(p1Power));
-        zonePowerTexts[i][0].setPosition(70, centerY - zoneHeight - 15 + i*(zoneHeight+40));
-        
-        int p2Power = game->getBoard().getPlayerPower(1, zone);
-        zonePowerTexts[i][1].setString(std::to_string(p2Power));
-        zonePowerTexts[i][1].setPosition(WINDOW_WIDTH - 70, centerY - zoneHeight - 15 + i*(zoneHeight+40));
-        
-        window.draw(zonePowerTexts[i][0]);
-        window.draw(zonePowerTexts[i][1]);
+        for (int player = 0; player < 2; ++player) {
+            FixedString<16> power;
+            power.append(state().players[player].zonePower[i]);
+
+            sf::RenderStates states;
+            states.transform.translate(player == 0 ? 70.f : WINDOW_WIDTH - 70.f, y);
+            window.draw(textCache.get(power.view(), zonePowerTexts[i][player].getCharacterSize()), states);
+        }
     }
 }
 
 
 void GameWindow::renderGameBoard() {
+    PROFILE_SCOPE("renderGameBoard");
     renderPlayerInfo();
     
     renderCombatZones();
     
-    renderPlayerHand(game->getPlayer(0), false);
-    renderPlayerHand(game->getPlayer(1), true);
+    renderPlayerHand(state().players[0], false);
+    renderPlayerHand(state().players[1], true);
 }
 
 
 void GameWindow::updateHoverState() {
-    sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-    std::vector<const Card*> visibleCards = getAllVisibleCards();
-    cardRenderer->updateHover(mousePos, visibleCards);
-}
-
-std::vector<const Card*> GameWindow::getAllVisibleCards() const {
-    std::vector<const Card*> cards;
-    
-    const auto& hand = game->getCurrentPlayer().getHand();
-    for (const auto& card : hand) {
-        cards.push_back(card.get());
-    }
-    
-    for (int zone = 0; zone < 3; zone++) {
-        const auto& zoneCards = game->getBoard().getPlayerZone(0, static_cast<CombatZone>(zone));
-        for (const auto& card : zoneCards) {
-            cards.push_back(card.get());
-        }
-        
-        const auto& oppZoneCards = game->getBoard().getPlayerZone(1, static_cast<CombatZone>(zone));
-        for (const auto& card : oppZoneCards) {
-            cards.push_back(card.get());
-        }
-    }
-    
-    return cards;
+    refreshLayout();
+    sf::Vector2f mousePos = window.mapPixelToCoords(
+        sf::Mouse::getPosition(window),
+        window.getDefaultView()
+    );
+    const CardLayout::Slot* slot = cardLayout.hitTest(mousePos);
+    cardRenderer->updateHover(mousePos, slot ? slot->card : nullptr);
 }
 
 void GameWindow::renderCombatZones() {
-    const float zoneHeight = cardRenderer->getCardSize().y + 35.f;
+    const float zoneHeight = cardLayout.zoneHeight();
     const float zoneWidth = window.getSize().x - 100;
-    const float centerY = window.getSize().y / 2.f;
     
     for (int i = 0; i < 3; i++) {
         CombatZone zone = static_cast<CombatZone>(i);
-        float zoneY = centerY - 200 + i * (zoneHeight + 15);
+        float zoneY = cardLayout.zoneTop(i);
         
         sf::RectangleShape zoneRect(sf::Vector2f(zoneWidth, zoneHeight));
         zoneRect.setPosition(50, zoneY);
         zoneRect.setFillColor(sf::Color(94, 70, 44));
         zoneRect.setOutlineColor(sf::Color(150, 150, 150, 200));
         zoneRect.setOutlineThickness(1.f);
-        window.draw(zoneRect);
-        
-        sf::Text zoneLabel(CardUtils::zoneToString(zone), font, 18);
-        zoneLabel.setPosition(60, zoneY + 5);
-        window.draw(zoneLabel);
+        scene.add(zoneRect);
         
-        int p1Score = game->getBoard().getPlayerPower(0, zone);
-        int p2Score = game->getBoard().getPlayerPower(1, zone);
+        scene.addText(textCache.get(CardUtils::enumName(zone), 18), sf::Vector2f(60, zoneY + 5));
         
-        sf::Text scoreText(std::to_string(p1Score) + " - " + std::to_string(p2Score), font, 20);
-        scoreText.setPosition(zoneWidth/2 + 25, zoneY + 5);
-        window.draw(scoreText);
+        FixedString<32> score;
+        score.append(state().players[0].zonePower[i])
+             .append(" - ")
+             .append(state().players[1].zonePower[i]);
+        scene.addText(textCache.get(score.view(), 20), sf::Vector2f(zoneWidth/2 + 25, zoneY + 5));
         
-        renderCardsInZone(game->getBoard().getPlayerZone(0, zone), 60, zoneY + 30);
-        renderCardsInZone(game->getBoard().getPlayerZone(1, zone), 
-                        window.getSize().x/2 + 10, zoneY + 30);
+        sf::FloatRect p1Start = cardLayout.zoneCardRect(0, i, 0);
+        sf::FloatRect p2Start = cardLayout.zoneCardRect(1, i, 0);
+        renderCardsInZone(state().players[0].zones[i], p1Start.left, p1Start.top);
+        renderCardsInZone(state().players[1].zones[i], p2Start.left, p2Start.top);
     }
 }
 
 
 
-void GameWindow::renderCardsInZone(const std::vector<std::unique_ptr<Card>>& cards, 
+void GameWindow::renderCardsInZone(const std::vector<CardView>& cards, 
                                  float startX, float startY) {
     const float cardWidth = cardRenderer->getCardSize().x;
     const float spacing = 10.f;
@@ -441,7 +532,7 @@ void GameWindow::renderCardsInZone(const std::vector<std::unique_ptr<Card>>& car
     for (size_t i = 0; i < cards.size(); ++i) {
         cardRenderer->renderCard(
             window,
-            *cards[i],
+            cards[i],
             startX + i * (cardWidth + spacing),
             startY,
             false,
@@ -450,8 +541,9 @@ void GameWindow::renderCardsInZone(const std::vector<std::unique_ptr<Card>>& car
     }
 }
 
-void GameWindow::renderPlayerHand(const Player& player, bool isCurrentPlayer) {
-    const auto& hand = player.getHand();
+void GameWindow::renderPlayerHand(const PlayerView& player, bool isCurrentPlayer) {
+    PROFILE_SCOPE("renderPlayerHand");
+    const auto& hand = player.hand;
     if (hand.empty()) return;
 
     const float spacing = 10.f;
@@ -463,26 +555,27 @@ void GameWindow::renderPlayerHand(const Player& player, bool isCurrentPlayer) {
     float baseY = isCurrentPlayer ? window.getSize().y - 150.f : 50.f;
     if (isCurrentPlayer){
     for (size_t i = 0; i < hand.size(); ++i) {
-        float xPos = startX + i * (cardWidth + spacing);
-        float yPos = baseY;
 
         sf::FloatRect cardPos = getHandCardPosition(player, i);
 
-        const_cast<Card*>(hand[i].get())->position = sf::Vector2f(xPos, yPos);
+        if (player.selectedIndex == static_cast<int>(i)) {
+            animatedCards.push_back({&hand[i], cardPos.left, cardPos.top});
+            continue;
+        }
             
         cardRenderer->renderCard(
             window,
-            *hand[i],
+            hand[i],
             cardPos.left,
             cardPos.top,
-            (player.getSelectedCardIndex() == i),
+            (player.selectedIndex == static_cast<int>(i)),
             isCurrentPlayer
         );
     }
     }  else {
         const float CARD_WIDTH = 80.f;
         const float SPACING = 15.f;
-        auto& hand = game->getOpponent().getHand();
+        const auto& hand = state().opponent().hand;
         
         float totalWidth = (hand.size() * CARD_WIDTH) + ((hand.size() - 1) * SPACING);
         float startX = (window.getSize().x - totalWidth) / 2;
@@ -492,7 +585,6 @@ void GameWindow::renderPlayerHand(const Player& player, bool isCurrentPlayer) {
             float x = startX + i * (CARD_WIDTH + SPACING);
             float y = baseY + (i % 2) * 20.f;
             
-            hand[i]->setPosition(x, y);
             cardRenderer->renderCardBack(window,x, y);
         }
         
@@ -512,30 +604,30 @@ void GameWindow::renderPlayerInfo() {
     panel.setFillColor(sf::Color(0, 0, 0, 180));
     panel.setOutlineColor(sf::Color(100, 100, 100));
     panel.setOutlineThickness(1.f);
-    window.draw(panel);
+    scene.add(panel);
 
     const float columnWidth = panelWidth / 2;
     const float textStartY = panelPos.y + 10.f;
-    const int currentIdx = game->getCurrentPlayerIndex();
+    const int currentIdx = state().currentPlayer;
 
     for (int i = 0; i < 2; ++i) {
-        const Player& p = game->getPlayer(i);
+        const PlayerView& p = state().players[i];
         const float xOffset = panelPos.x + (i * columnWidth);
         const bool isCurrent = (i == currentIdx);
 
-        sf::Text name(p.getName(), font, 22);
-        name.setPosition(xOffset + 15.f, textStartY);
-        name.setFillColor(isCurrent ? sf::Color(255, 215, 0) : sf::Color::White);
-        window.draw(name);
+        const sf::Text& name = textCache.get(p.name, 22, sf::Text::Regular,
+                                             isCurrent ? sf::Color(255, 215, 0) : sf::Color::White);
+        scene.addText(name, sf::Vector2f(xOffset + 15.f, textStartY));
 
-        sf::Text rounds("Rounds: " + std::to_string(p.getRoundsWon()) + "/2", font, 16);
-        rounds.setPosition(xOffset + 15.f, textStartY + 30.f);
-        window.draw(rounds);
+        FixedString<32> rounds;
+        rounds.append("Rounds: ").append(p.roundsWon).append("/2");
+        scene.addText(textCache.get(rounds.view(), 16), sf::Vector2f(xOffset + 15.f, textStartY + 30.f));
 
-        sf::Text cards("Cards: " + std::to_string(p.getHandSize()), font, 16);
-        cards.setPosition(xOffset + columnWidth - cards.getLocalBounds().width - 15.f, 
-                        textStartY + 30.f);
-        window.draw(cards);
+        FixedString<32> cardCount;
+        cardCount.append("Cards: ").append(static_cast<int>(p.hand.size()));
+        const sf::Text& cards = textCache.get(cardCount.view(), 16);
+        scene.addText(cards, sf::Vector2f(xOffset + columnWidth - cards.getLocalBounds().width - 15.f, 
+                                          textStartY + 30.f));
 
         if (isCurrent) {
             sf::ConvexShape arrow(3);
@@ -543,15 +635,15 @@ void GameWindow::renderPlayerInfo() {
             arrow.setPoint(1, sf::Vector2f(xOffset + 20.f, textStartY + 15.f));
             arrow.setPoint(2, sf::Vector2f(xOffset + 12.5f, textStartY + 25.f));
             arrow.setFillColor(sf::Color(255, 215, 0));
-            window.draw(arrow);
+            scene.add(arrow);
         }
     }
 }
 
 
 void GameWindow::syncPlayerIndex() {
-    if (game) { 
-        currentPlayerIndex = game->getCurrentPlayerIndex();
+    if (logic) { 
+        currentPlayerIndex = state().currentPlayer;
     }
 }
 bool GameWindow::isWindowValid() const { 
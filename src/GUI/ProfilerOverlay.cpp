@@ -0,0 +1,129 @@
+#include "../include/GUI/ProfilerOverlay.h"
+#include "../include/Utils/Profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+ProfilerOverlay::ProfilerOverlay(const sf::Font& font, const sf::Vector2f& position)
+    : position(position)
+{
+    panel.setPosition(position);
+    panel.setSize(sf::Vector2f(WIDTH, GRAPH_HEIGHT + 190.f));
+    panel.setFillColor(sf::Color(0, 0, 0, 190));
+    panel.setOutlineColor(sf::Color(100, 100, 100));
+    panel.setOutlineThickness(1.f);
+
+    const float budgetY = position.y + 10.f + GRAPH_HEIGHT * (1.f - 16.7f / GRAPH_MAX_MS);
+    budgetLine.setPosition(position.x + 10.f, budgetY);
+    budgetLine.setSize(sf::Vector2f(WIDTH - 20.f, 1.f));
+    budgetLine.setFillColor(sf::Color(255, 255, 255, 120));
+
+    scopeText.setFont(font);
+    scopeText.setCharacterSize(13);
+    scopeText.setFillColor(sf::Color(200, 255, 200));
+    scopeText.setPosition(position.x + 10.f, position.y + GRAPH_HEIGHT + 18.f);
+}
+
+void ProfilerOverlay::toggle() {
+    visible = !visible;
+    refreshTimer = 0.f;
+    if (visible) rebuild();
+}
+
+bool ProfilerOverlay::isVisible() const {
+    return visible;
+}
+
+void ProfilerOverlay::update(float deltaSeconds) {
+    if (!visible) return;
+
+    refreshTimer += deltaSeconds;
+    if (refreshTimer >= 0.25f) {
+        refreshTimer = 0.f;
+        rebuild();
+    }
+}
+
+void ProfilerOverlay::rebuild() {
+    bars.clear();
+
+#ifdef GWENT_PROFILING
+    const Profiler& profiler = Profiler::instance();
+    const std::size_t frameCount = profiler.getFrameCount();
+    const float barWidth = (WIDTH - 20.f) / Profiler::HISTORY;
+    const float graphBottom = position.y + 10.f + GRAPH_HEIGHT;
+
+    struct ScopeTotal {
+        const char* name;
+        std::int64_t totalUs;
+        std::int64_t worstUs;
+    };
+    ScopeTotal totals[16];
+    std::size_t scopeCount = 0;
+    std::int64_t frameTotalUs = 0;
+
+    for (std::size_t age = 0; age < frameCount; ++age) {
+        const Profiler::Frame& frame = profiler.getFrame(age);
+        frameTotalUs += frame.durationUs;
+
+        float ms = frame.durationUs / 1000.f;
+        float height = std::min(ms, GRAPH_MAX_MS) / GRAPH_MAX_MS * GRAPH_HEIGHT;
+        float left = position.x + 10.f + (Profiler::HISTORY - 1 - age) * barWidth;
+        sf::Color color = ms < 16.7f ? sf::Color(80, 200, 80)
+                        : ms < 33.4f ? sf::Color(230, 200, 60)
+                                     : sf::Color(220, 70, 60);
+
+        sf::Vector2f topLeft(left, graphBottom - height);
+        sf::Vector2f topRight(left + barWidth, graphBottom - height);
+        sf::Vector2f bottomRight(left + barWidth, graphBottom);
+        sf::Vector2f bottomLeft(left, graphBottom);
+        bars.append(sf::Vertex(topLeft, color));
+        bars.append(sf::Vertex(topRight, color));
+        bars.append(sf::Vertex(bottomRight, color));
+        bars.append(sf::Vertex(topLeft, color));
+        bars.append(sf::Vertex(bottomRight, color));
+        bars.append(sf::Vertex(bottomLeft, color));
+
+        for (const auto& event : frame.events) {
+            std::size_t i = 0;
+            while (i < scopeCount && std::strcmp(totals[i].name, event.name) != 0) ++i;
+            if (i == scopeCount) {
+                if (scopeCount == std::size(totals)) continue;
+                totals[scopeCount++] = {event.name, 0, 0};
+            }
+            totals[i].totalUs += event.durationUs;
+            totals[i].worstUs = std::max(totals[i].worstUs, event.durationUs);
+        }
+    }
+
+    std::sort(totals, totals + scopeCount, [](const ScopeTotal& a, const ScopeTotal& b) {
+        return a.totalUs > b.totalUs;
+    });
+
+    const float frames = frameCount > 0 ? static_cast<float>(frameCount) : 1.f;
+    std::string report;
+    char line[96];
+    std::snprintf(line, sizeof(line), "%-18s %7.2f ms avg  (F4: dump trace)\n",
+                  "frame", frameTotalUs / 1000.f / frames);
+    report += line;
+    for (std::size_t i = 0; i < scopeCount; ++i) {
+        std::snprintf(line, sizeof(line), "%-18s %7.3f ms avg %7.3f max\n",
+                      totals[i].name, totals[i].totalUs / 1000.f / frames, totals[i].worstUs / 1000.f);
+        report += line;
+    }
+    scopeText.setString(report);
+#else
+    scopeText.setString("Profiling is compiled out of this build");
+#endif
+}
+
+void ProfilerOverlay::draw(sf::RenderTarget& target) const {
+    if (!visible) return;
+
+    target.draw(panel);
+    target.draw(bars);
+    target.draw(budgetLine);
+    target.draw(scopeText);
+}
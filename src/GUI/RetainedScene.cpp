@@ -0,0 +1,74 @@
+#include "../include/GUI/RetainedScene.h"
+
+void RetainedScene::clear() {
+    drawables.clear();
+    cardVertices.clear();
+    baked = false;
+}
+
+void RetainedScene::addText(const sf::Text& text, const sf::Vector2f& position) {
+    drawables.push_back(std::make_unique<PlacedText>(text, position));
+}
+
+RetainedScene::PlacedText::PlacedText(const sf::Text& text, const sf::Vector2f& position)
+    : text(&text), position(position) {}
+
+void RetainedScene::PlacedText::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    states.transform.translate(position);
+    target.draw(*text, states);
+}
+
+sf::VertexArray& RetainedScene::getCardVertices() {
+    return cardVertices;
+}
+
+void RetainedScene::setCardTexture(const sf::Texture* texture) {
+    cardTexture = texture;
+}
+
+size_t RetainedScene::getDrawableCount() const {
+    return drawables.size() + (cardVertices.getVertexCount() > 0 ? 1 : 0);
+}
+
+// Composites the whole scene into an offscreen layer so that, until the next
+// clear(), drawing it is a single sprite blit.
+bool RetainedScene::bake(const sf::Vector2u& size, const sf::Color& clearColor) {
+    if (!layer || layer->getSize().x != size.x || layer->getSize().y != size.y) {
+        layer = std::make_unique<sf::RenderTexture>();
+        if (!layer->create(size.x, size.y)) {
+            layer.reset();
+            baked = false;
+            return false;
+        }
+    }
+
+    layer->clear(clearColor);
+    drawContents(*layer, sf::RenderStates::Default);
+    layer->display();
+
+    layerSprite.setTexture(layer->getTexture(), true);
+    baked = true;
+    return true;
+}
+
+bool RetainedScene::isBaked() const {
+    return baked;
+}
+
+void RetainedScene::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (baked) {
+        target.draw(layerSprite, states);
+        return;
+    }
+    drawContents(target, states);
+}
+
+void RetainedScene::drawContents(sf::RenderTarget& target, sf::RenderStates states) const {
+    for (const auto& drawable : drawables) {
+        target.draw(*drawable, states);
+    }
+    if (cardVertices.getVertexCount() > 0) {
+        states.texture = cardTexture;
+        target.draw(cardVertices, states);
+    }
+}
@@ -0,0 +1,41 @@
+#include "../include/GUI/TextCache.h"
+
+TextCache::TextCache(const sf::Font& font) : font(font) {}
+
+const sf::Text& TextCache::get(std::string_view text, unsigned size,
+                               sf::Uint32 style, const sf::Color& color) {
+    KeyView key{text, size, style, color.toInteger()};
+    auto it = entries.find(key);
+    if (it == entries.end()) {
+        sf::Text laidOut(std::string(text), font, size);
+        laidOut.setStyle(style);
+        laidOut.setFillColor(color);
+        // Forces the glyph geometry to be built now rather than on first draw.
+        laidOut.getLocalBounds();
+        ++layoutCount;
+
+        it = entries.emplace(Key{std::string(text), size, style, key.color},
+                             Entry{laidOut, generation}).first;
+    }
+    it->second.lastUsed = generation;
+    return it->second.text;
+}
+
+void TextCache::collect() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.lastUsed != generation) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    ++generation;
+}
+
+std::size_t TextCache::size() const {
+    return entries.size();
+}
+
+unsigned TextCache::getLayoutCount() const {
+    return layoutCount;
+}
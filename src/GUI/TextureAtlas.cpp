@@ -0,0 +1,137 @@
+#include "../include/GUI/TextureAtlas.h"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+TextureAtlas::TextureAtlas() {
+    sf::Image white;
+    white.create(4, 4, sf::Color::White);
+    whiteHandle = add(white);
+}
+
+std::size_t TextureAtlas::add(const sf::Image& image) {
+    pending.push_back(image);
+    regions.emplace_back();
+    built = false;
+    return regions.size() - 1;
+}
+
+// Shelf packing: images are placed tallest first, left to right, starting a
+// new shelf whenever the current one runs out of width.
+bool TextureAtlas::build() {
+    const unsigned width = std::min(PREFERRED_WIDTH, sf::Texture::getMaximumSize());
+    const unsigned padding = mipmapped ? MIPMAP_PADDING : PADDING;
+
+    std::vector<std::size_t> order(pending.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+        return pending[a].getSize().y > pending[b].getSize().y;
+    });
+
+    unsigned x = padding;
+    unsigned y = padding;
+    unsigned shelfHeight = 0;
+    for (std::size_t index : order) {
+        sf::Vector2u size = pending[index].getSize();
+        if (size.x + 2 * padding > width) {
+            std::cerr << "Texture atlas: image wider than atlas (" << size.x << "px)\n";
+            return false;
+        }
+        if (x + size.x + padding > width) {
+            x = padding;
+            y += shelfHeight + padding;
+            shelfHeight = 0;
+        }
+        regions[index] = sf::IntRect(x, y, size.x, size.y);
+        x += size.x + padding;
+        shelfHeight = std::max(shelfHeight, size.y);
+    }
+    const unsigned height = y + shelfHeight + padding;
+
+    if (height > sf::Texture::getMaximumSize()) {
+        std::cerr << "Texture atlas: " << width << "x" << height
+                  << " exceeds maximum texture size\n";
+        return false;
+    }
+
+    sf::Image atlasImage;
+    atlasImage.create(width, height, sf::Color::Transparent);
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        atlasImage.copy(pending[i], regions[i].left, regions[i].top);
+        if (mipmapped) {
+            extrudeEdges(atlasImage, regions[i], padding / 2);
+        }
+    }
+
+    if (!texture.loadFromImage(atlasImage)) {
+        std::cerr << "Texture atlas: failed to upload " << width << "x" << height << " texture\n";
+        return false;
+    }
+    texture.setSmooth(true);
+    if (mipmapped && !texture.generateMipmap()) {
+        std::cerr << "Texture atlas: mipmap generation not supported, using linear filtering\n";
+    }
+
+    pending.clear();
+    pending.shrink_to_fit();
+    built = true;
+    return true;
+}
+
+void TextureAtlas::clear() {
+    pending.clear();
+    regions.clear();
+    built = false;
+
+    sf::Image white;
+    white.create(4, 4, sf::Color::White);
+    whiteHandle = add(white);
+}
+
+const sf::Texture& TextureAtlas::getTexture() const {
+    return texture;
+}
+
+sf::IntRect TextureAtlas::getRegion(std::size_t handle) const {
+    return handle < regions.size() ? regions[handle] : sf::IntRect();
+}
+
+sf::IntRect TextureAtlas::getWhiteRegion() const {
+    sf::IntRect region = getRegion(whiteHandle);
+    return sf::IntRect(region.left + 1, region.top + 1, 2, 2);
+}
+
+bool TextureAtlas::isBuilt() const {
+    return built;
+}
+
+void TextureAtlas::setMipmapped(bool enabled) {
+    mipmapped = enabled;
+    built = false;
+}
+
+bool TextureAtlas::isMipmapped() const {
+    return mipmapped;
+}
+
+// Repeats each region's outermost pixels into its padding so the coarser
+// mip levels blend a region with itself rather than with its neighbours.
+void TextureAtlas::extrudeEdges(sf::Image& atlasImage, const sf::IntRect& region, unsigned border) {
+    const int left = region.left;
+    const int top = region.top;
+    const int right = region.left + region.width - 1;
+    const int bottom = region.top + region.height - 1;
+    const int b = static_cast<int>(border);
+
+    for (int y = top - b; y <= bottom + b; ++y) {
+        const int sourceY = std::clamp(y, top, bottom);
+        for (int x = left - b; x <= right + b; ++x) {
+            if (x >= left && x <= right && y >= top && y <= bottom) {
+                x = right;
+                continue;
+            }
+            const int sourceX = std::clamp(x, left, right);
+            atlasImage.setPixel(x, y, atlasImage.getPixel(sourceX, sourceY));
+        }
+    }
+}
@@ -1,4 +1,5 @@
 #include "../include/GUI/Tooltip.h"
+#include <algorithm>
 
 Tooltip::Tooltip(const sf::Font& font, sf::RenderWindow& window) {
     text.setFont(font);
@@ -12,6 +13,7 @@ Tooltip::Tooltip(const sf::Font& font, sf::RenderWindow& window) {
 
 void Tooltip::setText(const std::string& text) {
     this->text.setString(text);
+    currentKey = nullptr;
     
     sf::FloatRect bounds = this->text.getLocalBounds();
     background.setSize(sf::Vector2f(
@@ -31,6 +33,35 @@ void Tooltip::draw(sf::RenderTarget& target) const {
     target.draw(text);
 }
 
+// Most recently used layouts are kept at the front; a hit swaps the laid-out
+// text back in so the glyph geometry is not rebuilt.
+bool Tooltip::restoreLayout(const void* key, std::uint32_t version) {
+    if (key == currentKey && version == currentVersion) return true;
+
+    for (size_t i = 0; i < layoutCache.size(); ++i) {
+        if (layoutCache[i].key == key && layoutCache[i].version == version) {
+            std::rotate(layoutCache.begin(), layoutCache.begin() + i, layoutCache.begin() + i + 1);
+            sf::Vector2f position = text.getPosition();
+            text = layoutCache.front().text;
+            text.setPosition(position);
+            background.setSize(layoutCache.front().size);
+            currentKey = key;
+            currentVersion = version;
+            return true;
+        }
+    }
+    return false;
+}
+
+void Tooltip::storeLayout(const void* key, std::uint32_t version) {
+    if (layoutCache.size() >= LAYOUT_CACHE_SIZE) {
+        layoutCache.pop_back();
+    }
+    layoutCache.insert(layoutCache.begin(), CachedLayout{key, version, text, background.getSize()});
+    currentKey = key;
+    currentVersion = version;
+}
+
 void Tooltip::show(bool visible) {
     if (this == nullptr) return;
     isVisible = visible;
@@ -0,0 +1,57 @@
+#include "../include/Server/MatchHistory.h"
+#include "../include/Utils/CardUtils.h"
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+    void printRecord(const MatchRecord& record) {
+        std::cout << "match " << record.matchId << " finished at " << record.finishedAt
+                  << " seed " << record.seed << "\n";
+        for (int i = 0; i < 2; ++i) {
+            std::cout << "  player " << i << ": " << record.players[i] << " ("
+                      << CardUtils::factionToString(record.factions[i]) << ")\n";
+        }
+        for (std::size_t round = 0; round < record.roundScores.size(); ++round) {
+            std::cout << "  round " << round + 1 << ": " << record.roundScores[round][0]
+                      << " - " << record.roundScores[round][1] << "\n";
+        }
+        std::cout << "  moves:";
+        for (const auto& move : record.moves) {
+            std::cout << " " << int(move.player) << (move.pass ? ":pass" : ":" + std::to_string(move.card));
+        }
+        std::cout << "\n";
+    }
+}
+
+// gwent_history <historyDir> [match <id> | player <name>]
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: gwent_history <historyDir> [match <id> | player <name>]" << std::endl;
+        return 1;
+    }
+
+    try {
+        MatchHistory history(argv[1], true);
+        const std::string query = argc > 3 ? argv[2] : "";
+
+        if (query == "match") {
+            MatchRecord record;
+            if (!history.find(std::strtoull(argv[3], nullptr, 10), record)) {
+                std::cerr << "No match " << argv[3] << std::endl;
+                return 1;
+            }
+            printRecord(record);
+        } else if (query == "player") {
+            for (std::uint64_t id : history.findByPlayer(argv[3])) {
+                std::cout << id << "\n";
+            }
+        } else {
+            std::cout << history.size() << " matches, last id " << history.getLastMatchId() << "\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
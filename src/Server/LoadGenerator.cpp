@@ -0,0 +1,420 @@
+#include "../include/Server/Protocol.h"
+#include "../include/Server/Socket.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/epoll.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// gwent_loadgen [host] [port] [clients] [matchesPerClient] [text|binary] [threads]
+//
+// Simulates many independent clients, each on its own connection playing
+// matches back to back with a simple random policy. Clients are spread over
+// a few threads that multiplex their sockets with epoll, so ten thousand
+// clients do not need ten thousand threads. Reports matches per second,
+// move latency percentiles and wire bytes per game.
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // Safety valve in case a rules bug keeps a match alive forever.
+    constexpr int MAX_MOVES = 500;
+
+    struct MatchState {
+        std::uint64_t id = 0;
+        int currentPlayer = 0;
+        bool gameOver = false;
+        int handSize[2] = {0, 0};
+    };
+
+    struct WorkerResult {
+        std::vector<std::uint32_t> latenciesUs;
+        unsigned matches = 0;
+        unsigned rejectedMoves = 0;
+        unsigned failedClients = 0;
+        std::uint64_t bytesSent = 0;
+        std::uint64_t bytesReceived = 0;
+        std::string error;
+    };
+
+    struct Client {
+        enum class Phase { CREATING, PLAYING, REFRESHING, ENDING, DONE };
+
+        int fd = -1;
+        Phase phase = Phase::CREATING;
+        MatchState state;
+        // The client plays both seats, and binary answers carry the deltas
+        // since the last answer to the seat that moved.
+        MatchState views[2];
+        int seat = 0;
+        unsigned matchesLeft = 0;
+        int moves = 0;
+        std::string names;
+        std::string input;
+        std::string output;
+        bool watchingWrites = false;
+        Clock::time_point sentAt;
+        std::mt19937 rng;
+    };
+
+    bool parseSummary(std::istringstream& in, MatchState& state) {
+        int over = 0;
+        int rounds[2];
+        in >> state.currentPlayer >> over >> state.handSize[0] >> state.handSize[1]
+           >> rounds[0] >> rounds[1];
+        state.gameOver = over != 0;
+        return static_cast<bool>(in);
+    }
+
+    void applyDeltas(const Protocol::Message& message, MatchState& state) {
+        for (const auto& delta : message.deltas) {
+            switch (delta.kind) {
+                case Protocol::DeltaKind::HAND_SIZE:
+                    state.handSize[delta.player & 1] = delta.value;
+                    break;
+                case Protocol::DeltaKind::TURN:
+                    state.currentPlayer = delta.player & 1;
+                    break;
+                case Protocol::DeltaKind::GAME_OVER:
+                    state.gameOver = true;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    class Worker {
+    public:
+        Worker(bool binary, WorkerResult& result) : binary(binary), result(result) {
+            epollFd = epoll_create1(EPOLL_CLOEXEC);
+            if (epollFd < 0) throw std::runtime_error("epoll_create1 failed");
+        }
+
+        ~Worker() {
+            for (auto& client : clients) {
+                Net::closeSocket(client.fd);
+            }
+            Net::closeSocket(epollFd);
+        }
+
+        void connect(const std::string& host, unsigned short port, unsigned count,
+                     unsigned matches, unsigned firstSeed) {
+            clients.resize(count);
+            for (unsigned i = 0; i < count; ++i) {
+                Client& client = clients[i];
+                client.fd = Net::connectTcp(host, port);
+                Net::setNonBlocking(client.fd);
+                client.matchesLeft = matches;
+                client.rng.seed(firstSeed + i);
+                client.names = "Bot" + std::to_string(firstSeed + i) + "a Bot" +
+                               std::to_string(firstSeed + i) + "b";
+
+                epoll_event event{};
+                event.events = EPOLLIN;
+                event.data.u32 = i;
+                epoll_ctl(epollFd, EPOLL_CTL_ADD, client.fd, &event);
+            }
+        }
+
+        void run() {
+            for (auto& client : clients) {
+                sendNew(client);
+            }
+            active = clients.size();
+
+            epoll_event events[256];
+            while (active > 0) {
+                int count = epoll_wait(epollFd, events, 256, -1);
+                if (count < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::runtime_error("epoll_wait failed");
+                }
+                for (int i = 0; i < count; ++i) {
+                    Client& client = clients[events[i].data.u32];
+                    if (client.phase == Client::Phase::DONE) continue;
+                    if (events[i].events & EPOLLOUT) flush(client);
+                    if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) onReadable(client);
+                }
+            }
+        }
+
+    private:
+        bool binary;
+        WorkerResult& result;
+        int epollFd = -1;
+        std::vector<Client> clients;
+        std::size_t active = 0;
+        Protocol::Message frame;
+
+        void onReadable(Client& client) {
+            const std::size_t before = client.input.size();
+            Net::IoStatus status = Net::readAvailable(client.fd, client.input);
+            result.bytesReceived += client.input.size() - before;
+
+            while (client.phase != Client::Phase::DONE && takeReply(client)) {
+            }
+            if (status == Net::IoStatus::CLOSED && client.phase != Client::Phase::DONE) {
+                ++result.failedClients;
+                finish(client);
+            }
+        }
+
+        // Consumes one reply if a complete one is buffered and sends the
+        // client's next request.
+        bool takeReply(Client& client) {
+            bool ok;
+            if (binary) {
+                std::size_t consumed = 0;
+                auto status = Protocol::decode(client.input, frame, consumed);
+                if (status == Protocol::DecodeStatus::INCOMPLETE) return false;
+                if (status == Protocol::DecodeStatus::MALFORMED) {
+                    result.error = "Malformed reply from server";
+                    ++result.failedClients;
+                    finish(client);
+                    return false;
+                }
+                client.input.erase(0, consumed);
+                ok = frame.type != Protocol::MessageType::ERROR;
+                if (ok && client.phase == Client::Phase::CREATING) client.state.id = frame.matchId;
+                if (ok) {
+                    MatchState& view = client.views[client.seat];
+                    applyDeltas(frame, view);
+                    view.id = client.state.id;
+                    client.state = view;
+                }
+            } else {
+                std::size_t end = client.input.find('\n');
+                if (end == std::string::npos) return false;
+                std::istringstream line(client.input.substr(0, end));
+                client.input.erase(0, end + 1);
+
+                std::string status;
+                line >> status;
+                ok = status == "OK";
+                if (ok && client.phase == Client::Phase::CREATING) line >> client.state.id;
+                if (ok && client.phase != Client::Phase::ENDING) ok = parseSummary(line, client.state);
+            }
+
+            switch (client.phase) {
+                case Client::Phase::CREATING:
+                    if (!ok) {
+                        result.error = "Match creation rejected";
+                        ++result.failedClients;
+                        finish(client);
+                        return false;
+                    }
+                    client.moves = 0;
+                    nextMove(client);
+                    break;
+                case Client::Phase::PLAYING: {
+                    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                        Clock::now() - client.sentAt);
+                    result.latenciesUs.push_back(static_cast<std::uint32_t>(elapsed.count()));
+                    if (!ok) {
+                        ++result.rejectedMoves;
+                        // Binary state arrives as deltas, so a rejected move leaves it intact.
+                        if (!binary) {
+                            send(client, "STATE " + std::to_string(client.state.id), Client::Phase::REFRESHING);
+                            break;
+                        }
+                    }
+                    nextMove(client);
+                    break;
+                }
+                case Client::Phase::REFRESHING:
+                    nextMove(client);
+                    break;
+                case Client::Phase::ENDING:
+                    ++result.matches;
+                    if (--client.matchesLeft == 0) {
+                        finish(client);
+                        return false;
+                    }
+                    client.state = MatchState{};
+                    client.views[0] = client.views[1] = MatchState{};
+                    sendNew(client);
+                    break;
+                case Client::Phase::DONE:
+                    break;
+            }
+            return true;
+        }
+
+        void nextMove(Client& client) {
+            MatchState& state = client.state;
+            if (state.gameOver || client.moves >= MAX_MOVES) {
+                if (binary) {
+                    frame.clear();
+                    frame.type = Protocol::MessageType::END_MATCH;
+                    frame.matchId = state.id;
+                    sendFrame(client, Client::Phase::ENDING);
+                } else {
+                    send(client, "END " + std::to_string(state.id), Client::Phase::ENDING);
+                }
+                return;
+            }
+
+            // Plays a random card most of the time and passes otherwise.
+            const int hand = state.handSize[state.currentPlayer];
+            const bool play = hand > 0 && client.rng() % 10 < 8;
+            const int index = play ? static_cast<int>(client.rng() % hand) : 0;
+            ++client.moves;
+            client.sentAt = Clock::now();
+            client.seat = state.currentPlayer;
+
+            if (binary) {
+                frame.clear();
+                frame.type = play ? Protocol::MessageType::PLAY : Protocol::MessageType::PASS;
+                frame.matchId = state.id;
+                frame.player = static_cast<std::uint8_t>(state.currentPlayer);
+                frame.index = static_cast<std::uint32_t>(index);
+                sendFrame(client, Client::Phase::PLAYING);
+            } else {
+                std::string move = play ? "PLAY " : "PASS ";
+                move += std::to_string(state.id) + " " + std::to_string(state.currentPlayer);
+                if (play) move += " " + std::to_string(index);
+                send(client, move, Client::Phase::PLAYING);
+            }
+        }
+
+        void sendNew(Client& client) {
+            client.seat = 0;
+            if (binary) {
+                frame.clear();
+                frame.type = Protocol::MessageType::NEW_MATCH;
+                frame.text = client.names;
+                sendFrame(client, Client::Phase::CREATING);
+            } else {
+                send(client, "NEW " + client.names, Client::Phase::CREATING);
+            }
+        }
+
+        void send(Client& client, const std::string& line, Client::Phase next) {
+            client.output += line;
+            client.output += '\n';
+            result.bytesSent += line.size() + 1;
+            client.phase = next;
+            flush(client);
+        }
+
+        void sendFrame(Client& client, Client::Phase next) {
+            const std::size_t before = client.output.size();
+            Protocol::encode(frame, client.output);
+            result.bytesSent += client.output.size() - before;
+            client.phase = next;
+            flush(client);
+        }
+
+        void flush(Client& client) {
+            Net::IoStatus status = Net::writePending(client.fd, client.output);
+            if (status == Net::IoStatus::CLOSED) {
+                ++result.failedClients;
+                finish(client);
+                return;
+            }
+            const bool blocked = status == Net::IoStatus::WOULD_BLOCK;
+            if (blocked != client.watchingWrites) {
+                client.watchingWrites = blocked;
+                epoll_event event{};
+                event.events = EPOLLIN | (blocked ? static_cast<std::uint32_t>(EPOLLOUT) : 0u);
+                event.data.u32 = static_cast<std::uint32_t>(&client - clients.data());
+                epoll_ctl(epollFd, EPOLL_CTL_MOD, client.fd, &event);
+            }
+        }
+
+        void finish(Client& client) {
+            if (client.phase == Client::Phase::DONE) return;
+            client.phase = Client::Phase::DONE;
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+            Net::closeSocket(client.fd);
+            client.fd = -1;
+            --active;
+        }
+    };
+
+    std::uint32_t percentile(const std::vector<std::uint32_t>& sorted, double p) {
+        if (sorted.empty()) return 0;
+        std::size_t rank = static_cast<std::size_t>(p * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::string host = argc > 1 ? argv[1] : "127.0.0.1";
+    const unsigned short port = argc > 2 ? static_cast<unsigned short>(std::atoi(argv[2])) : 7777;
+    const unsigned clients = argc > 3 ? static_cast<unsigned>(std::atoi(argv[3])) : 16;
+    const unsigned matchesEach = argc > 4 ? static_cast<unsigned>(std::atoi(argv[4])) : 100;
+    const bool binary = argc > 5 && std::string(argv[5]) == "binary";
+    const unsigned hardware = std::thread::hardware_concurrency();
+    unsigned threadCount = argc > 6 ? static_cast<unsigned>(std::atoi(argv[6])) : (hardware ? hardware : 4);
+    threadCount = std::max(1u, std::min(threadCount, clients));
+
+    const std::size_t fileLimit = Net::raiseFileLimit();
+    if (clients + 64 > fileLimit) {
+        std::cerr << "Warning: " << clients << " clients but only " << fileLimit << " file descriptors\n";
+    }
+
+    std::vector<WorkerResult> results(threadCount);
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+
+    auto start = Clock::now();
+    for (unsigned t = 0; t < threadCount; ++t) {
+        const unsigned first = clients * t / threadCount;
+        const unsigned count = clients * (t + 1) / threadCount - first;
+        workers.emplace_back([&, t, first, count] {
+            try {
+                Worker worker(binary, results[t]);
+                worker.connect(host, port, count, matchesEach, first + 1);
+                worker.run();
+            } catch (const std::exception& e) {
+                results[t].error = e.what();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<std::uint32_t> latencies;
+    unsigned matches = 0;
+    unsigned rejected = 0;
+    unsigned failed = 0;
+    std::uint64_t sent = 0;
+    std::uint64_t received = 0;
+    for (const auto& result : results) {
+        latencies.insert(latencies.end(), result.latenciesUs.begin(), result.latenciesUs.end());
+        matches += result.matches;
+        rejected += result.rejectedMoves;
+        failed += result.failedClients;
+        sent += result.bytesSent;
+        received += result.bytesReceived;
+        if (!result.error.empty()) {
+            std::cerr << "Worker error: " << result.error << "\n";
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::printf("%u matches in %.2f s (%.1f matches/sec), %u %s clients on %u threads, %u failed\n",
+                matches, seconds, matches / seconds, clients, binary ? "binary" : "text",
+                threadCount, failed);
+    std::printf("%zu moves (%u rejected), latency p50 %u us, p99 %u us, max %u us\n",
+                latencies.size(), rejected, percentile(latencies, 0.50),
+                percentile(latencies, 0.99), latencies.empty() ? 0u : latencies.back());
+    if (matches > 0) {
+        std::printf("bytes per game: %.0f sent, %.0f received\n",
+                    static_cast<double>(sent) / matches, static_cast<double>(received) / matches);
+    }
+    return 0;
+}
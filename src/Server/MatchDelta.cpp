@@ -0,0 +1,124 @@
+#include "../include/Server/MatchDelta.h"
+#include "../include/Core/Game.h"
+#include <algorithm>
+
+using Protocol::Delta;
+using Protocol::DeltaKind;
+
+void MatchShadow::diff(const Game& game, const CardCatalog& catalog, std::vector<Delta>& out) {
+    const Board& board = game.getBoard();
+    for (int player = 0; player < 2; ++player) {
+        for (int zone = 0; zone < 3; ++zone) {
+            diffRow(board.getPlayerZone(player, static_cast<CombatZone>(zone)), zones[player][zone],
+                    player, zone, false, catalog, out);
+        }
+    }
+    if (seat != NO_SEAT) {
+        diffRow(game.getPlayer(seat).getHand(), hand, seat, 0, true, catalog, out);
+    }
+
+    for (int zone = 0; zone < 3; ++zone) {
+        WeatherType current = board.getWeatherType(static_cast<CombatZone>(zone));
+        if (current != weather[zone]) {
+            weather[zone] = current;
+            out.push_back({DeltaKind::WEATHER_SET, 0, static_cast<std::uint8_t>(zone), 0, 0,
+                           static_cast<std::int32_t>(current)});
+        }
+    }
+
+    for (int player = 0; player < 2; ++player) {
+        const Player& p = game.getPlayer(player);
+        int cards = static_cast<int>(p.getHandSize());
+        if (cards != handSize[player]) {
+            handSize[player] = cards;
+            out.push_back({DeltaKind::HAND_SIZE, static_cast<std::uint8_t>(player), 0, 0, 0, cards});
+        }
+    }
+
+    // Pass flags are cleared by a new round, which the client infers from ROUND_END.
+    std::array<int, 2> won{game.getPlayer(0).getRoundsWon(), game.getPlayer(1).getRoundsWon()};
+    if (game.getCurrentRound() != round || won != roundsWon) {
+        std::uint8_t winner = won[0] != roundsWon[0] ? 0 : won[1] != roundsWon[1] ? 1 : 2;
+        round = game.getCurrentRound();
+        roundsWon = won;
+        passed = {false, false};
+        out.push_back({DeltaKind::ROUND_END, winner, 0, 0, 0, round});
+    }
+    for (int player = 0; player < 2; ++player) {
+        if (game.hasPassed(player) && !passed[player]) {
+            passed[player] = true;
+            out.push_back({DeltaKind::PASSED, static_cast<std::uint8_t>(player)});
+        }
+    }
+
+    if (game.getCurrentPlayerIndex() != currentPlayer) {
+        currentPlayer = game.getCurrentPlayerIndex();
+        out.push_back({DeltaKind::TURN, static_cast<std::uint8_t>(currentPlayer)});
+    }
+    if (game.isGameOver() && !gameOver) {
+        gameOver = true;
+        std::uint8_t winner = won[0] > won[1] ? 0 : won[1] > won[0] ? 1 : 2;
+        out.push_back({DeltaKind::GAME_OVER, winner});
+    }
+}
+
+// Rows only ever lose cards or gain them at the end, so the surviving cards
+// keep their relative order. Removals are sent from the highest slot down and
+// additions from the lowest slot up, which lets the client replay them in
+// order against its own copy of the row. A hand is diffed the same way,
+// without powers.
+void MatchShadow::diffRow(const std::vector<std::unique_ptr<Card>>& cards, std::vector<Slot>& previous,
+                          int player, int zone, bool inHand, const CardCatalog& catalog,
+                          std::vector<Delta>& out) {
+    const DeltaKind added = inHand ? DeltaKind::HAND_CARD_ADDED : DeltaKind::CARD_ADDED;
+    const DeltaKind removed = inHand ? DeltaKind::HAND_CARD_REMOVED : DeltaKind::CARD_REMOVED;
+
+    scratch.clear();
+    for (const auto& card : cards) {
+        scratch.push_back({card.get(), catalog.idOf(card->getName()), card->getPower()});
+    }
+
+    auto sameCard = [](const Slot& a, const Slot& b) {
+        return a.identity == b.identity && a.card == b.card;
+    };
+    auto contains = [&](const std::vector<Slot>& row, const Slot& slot) {
+        return std::any_of(row.begin(), row.end(), [&](const Slot& s) { return sameCard(s, slot); });
+    };
+
+    const auto p = static_cast<std::uint8_t>(player);
+    const auto z = static_cast<std::uint8_t>(zone);
+
+    for (std::size_t i = previous.size(); i-- > 0;) {
+        if (!contains(scratch, previous[i])) {
+            out.push_back({removed, p, z, static_cast<std::uint32_t>(i)});
+            previous.erase(previous.begin() + i);
+        }
+    }
+
+    // A row that was reordered cannot be patched slot by slot; resend it.
+    std::size_t matched = 0;
+    for (const Slot& slot : scratch) {
+        if (matched < previous.size() && sameCard(previous[matched], slot)) ++matched;
+    }
+    if (matched != previous.size()) {
+        for (std::size_t i = previous.size(); i-- > 0;) {
+            out.push_back({removed, p, z, static_cast<std::uint32_t>(i)});
+        }
+        previous.clear();
+    }
+
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < scratch.size(); ++i) {
+        const Slot& slot = scratch[i];
+        if (kept < previous.size() && sameCard(previous[kept], slot)) {
+            if (!inHand && previous[kept].power != slot.power) {
+                out.push_back({DeltaKind::POWER_CHANGED, p, z, static_cast<std::uint32_t>(i), 0, slot.power});
+            }
+            ++kept;
+        } else {
+            out.push_back({added, p, z, static_cast<std::uint32_t>(i), slot.card, inHand ? 0 : slot.power});
+        }
+    }
+
+    previous = scratch;
+}
@@ -0,0 +1,418 @@
+#include "../include/Server/MatchHistory.h"
+#include "../include/Utils/Varint.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+    using namespace Varint;
+
+    constexpr std::uint32_t MAGIC = 0x484D5747; // "GWMH" on disk
+    constexpr std::uint16_t VERSION = 1;
+    constexpr std::size_t HEADER_SIZE = 32;
+    constexpr std::uint32_t MAX_PAYLOAD = 1024 * 1024;
+    // A new segment is started once the active one reaches this size.
+    constexpr std::uint64_t SEGMENT_BYTES = 64 * 1024 * 1024;
+    // Appenders wait while this much is queued but not yet written.
+    constexpr std::size_t MAX_QUEUED = 32 * 1024 * 1024;
+
+    struct Header {
+        std::uint32_t length;
+        std::uint32_t checksum;
+        std::uint64_t matchId;
+        std::uint64_t finishedAt;
+    };
+
+    void putFixed(char* out, std::uint64_t value, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            out[i] = static_cast<char>(value >> (8 * i));
+        }
+    }
+
+    std::uint64_t getFixed(const char* in, int bytes) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<std::uint64_t>(static_cast<unsigned char>(in[i])) << (8 * i);
+        }
+        return value;
+    }
+
+    // FNV-1a; enough to tell a torn or overwritten record from a good one.
+    std::uint32_t checksum(std::string_view data) {
+        std::uint32_t hash = 2166136261u;
+        for (char c : data) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+        }
+        return hash;
+    }
+
+    // Layout: magic u32, version u16, reserved u16, payload length u32,
+    // checksum u32, match id u64, finish time u64; all little-endian.
+    bool readHeader(const char* in, Header& header) {
+        if (getFixed(in, 4) != MAGIC || getFixed(in + 4, 2) != VERSION) return false;
+        header.length = static_cast<std::uint32_t>(getFixed(in + 8, 4));
+        header.checksum = static_cast<std::uint32_t>(getFixed(in + 12, 4));
+        header.matchId = getFixed(in + 16, 8);
+        header.finishedAt = getFixed(in + 24, 8);
+        return header.length <= MAX_PAYLOAD;
+    }
+
+    void encodeRecord(const MatchRecord& record, std::string& out) {
+        const std::size_t start = out.size();
+        out.resize(start + HEADER_SIZE);
+
+        for (const auto& name : record.players) {
+            putVarint(out, name.size());
+            out += name;
+        }
+        for (Faction faction : record.factions) {
+            out.push_back(static_cast<char>(faction));
+        }
+        putVarint(out, record.seed);
+        putVarint(out, record.roundScores.size());
+        for (const auto& scores : record.roundScores) {
+            putSigned(out, scores[0]);
+            putSigned(out, scores[1]);
+        }
+        putVarint(out, record.moves.size());
+        for (const auto& move : record.moves) {
+            putVarint(out, (static_cast<std::uint64_t>(move.card) << 2) |
+                           (static_cast<std::uint64_t>(move.player & 1) << 1) |
+                           (move.pass ? 1 : 0));
+        }
+
+        const std::size_t length = out.size() - start - HEADER_SIZE;
+        if (length > MAX_PAYLOAD) {
+            out.resize(start);
+            throw std::runtime_error("Match record too large: " + std::to_string(record.matchId));
+        }
+        char* header = &out[start];
+        putFixed(header, MAGIC, 4);
+        putFixed(header + 4, VERSION, 2);
+        putFixed(header + 6, 0, 2);
+        putFixed(header + 8, length, 4);
+        putFixed(header + 12, checksum(std::string_view(header + HEADER_SIZE, length)), 4);
+        putFixed(header + 16, record.matchId, 8);
+        putFixed(header + 24, record.finishedAt, 8);
+    }
+
+    bool decodePayload(std::string_view payload, MatchRecord& record) {
+        Reader in(payload);
+        for (auto& name : record.players) {
+            std::string_view text = in.bytes(static_cast<std::size_t>(in.varint32()));
+            name.assign(text.data(), text.size());
+        }
+        for (auto& faction : record.factions) {
+            faction = static_cast<Faction>(in.byte());
+        }
+        record.seed = in.varint32();
+
+        std::uint64_t rounds = in.varint();
+        if (rounds > payload.size()) return false;
+        record.roundScores.resize(static_cast<std::size_t>(rounds));
+        for (auto& scores : record.roundScores) {
+            scores[0] = in.signed32();
+            scores[1] = in.signed32();
+        }
+
+        std::uint64_t moves = in.varint();
+        if (moves > payload.size()) return false;
+        record.moves.resize(static_cast<std::size_t>(moves));
+        for (auto& move : record.moves) {
+            std::uint64_t packed = in.varint();
+            move.pass = packed & 1;
+            move.player = static_cast<std::uint8_t>((packed >> 1) & 1);
+            move.card = static_cast<std::uint32_t>(packed >> 2);
+        }
+        return in.ok() && in.atEnd();
+    }
+
+    std::string segmentPath(const std::string& directory, std::uint32_t number) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%08u.seg", number);
+        return (fs::path(directory) / name).string();
+    }
+
+    bool writeAll(int fd, const char* data, std::size_t size) {
+        while (size > 0) {
+            ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data += written;
+            size -= static_cast<std::size_t>(written);
+        }
+        return true;
+    }
+
+    bool readAt(int fd, char* data, std::size_t size, std::uint64_t offset) {
+        while (size > 0) {
+            ssize_t got = ::pread(fd, data, size, static_cast<off_t>(offset));
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) return false;
+            data += got;
+            size -= static_cast<std::size_t>(got);
+            offset += static_cast<std::uint64_t>(got);
+        }
+        return true;
+    }
+}
+
+MatchHistory::MatchHistory(const std::string& directory, bool readOnly)
+    : directory(directory), readOnly(readOnly) {
+    if (!readOnly) {
+        std::error_code error;
+        fs::create_directories(directory, error);
+        if (error) {
+            throw std::runtime_error("Failed to create history directory: " + directory);
+        }
+    }
+
+    load();
+
+    if (!readOnly) {
+        if (segments.empty()) openSegment(0);
+        writer = std::thread(&MatchHistory::run, this);
+    }
+}
+
+MatchHistory::~MatchHistory() {
+    if (writer.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        writer.join();
+    }
+    for (int fd : segments) {
+        ::close(fd);
+    }
+}
+
+void MatchHistory::append(const MatchRecord& record) {
+    if (readOnly) {
+        throw std::runtime_error("Match history is read-only");
+    }
+
+    // Encoding happens on the caller's thread, so the writer only copies bytes.
+    thread_local std::string encoded;
+    encoded.clear();
+    encodeRecord(record, encoded);
+
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        progress.wait(lock, [this] { return queued.size() < MAX_QUEUED; });
+        queuedIndex.push_back({record.matchId, queued.size(),
+                               static_cast<std::uint32_t>(encoded.size()), record.players});
+        queued += encoded;
+        ++appendedCount;
+    }
+    wake.notify_one();
+}
+
+void MatchHistory::flush() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    const std::uint64_t target = appendedCount;
+    progress.wait(lock, [this, target] { return syncedCount >= target; });
+}
+
+bool MatchHistory::find(std::uint64_t matchId, MatchRecord& record) const {
+    Location location;
+    int fd;
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        auto it = byMatch.find(matchId);
+        if (it == byMatch.end()) return false;
+        location = it->second;
+        fd = segments[location.segment];
+    }
+
+    std::string data(location.length, '\0');
+    Header header;
+    if (!readAt(fd, &data[0], data.size(), location.offset) ||
+        !readHeader(data.data(), header) ||
+        header.length + HEADER_SIZE != data.size()) {
+        return false;
+    }
+    std::string_view payload(data.data() + HEADER_SIZE, header.length);
+    if (checksum(payload) != header.checksum || !decodePayload(payload, record)) {
+        return false;
+    }
+    record.matchId = header.matchId;
+    record.finishedAt = header.finishedAt;
+    return true;
+}
+
+std::vector<std::uint64_t> MatchHistory::findByPlayer(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(indexMutex);
+    auto it = byPlayer.find(name);
+    return it != byPlayer.end() ? it->second : std::vector<std::uint64_t>();
+}
+
+std::size_t MatchHistory::size() const {
+    std::lock_guard<std::mutex> lock(indexMutex);
+    return byMatch.size();
+}
+
+std::uint64_t MatchHistory::getLastMatchId() const {
+    std::lock_guard<std::mutex> lock(indexMutex);
+    return lastMatchId;
+}
+
+void MatchHistory::load() {
+    if (!fs::is_directory(directory)) {
+        throw std::runtime_error("No match history in " + directory);
+    }
+
+    std::vector<std::uint32_t> numbers;
+    for (const auto& entry : fs::directory_iterator(directory)) {
+        const fs::path& path = entry.path();
+        const std::string stem = path.stem().string();
+        if (path.extension() != ".seg" || stem.empty() ||
+            !std::all_of(stem.begin(), stem.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            continue;
+        }
+        numbers.push_back(static_cast<std::uint32_t>(std::stoul(stem)));
+    }
+    std::sort(numbers.begin(), numbers.end());
+
+    for (std::size_t i = 0; i < numbers.size(); ++i) {
+        const std::string path = segmentPath(directory, numbers[i]);
+        int fd = ::open(path.c_str(), readOnly ? O_RDONLY | O_CLOEXEC : O_RDWR | O_APPEND | O_CLOEXEC);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open " + path + ": " + std::strerror(errno));
+        }
+        segments.push_back(fd);
+        nextSegmentNumber = numbers[i] + 1;
+        loadSegment(i, i + 1 == numbers.size());
+    }
+}
+
+// Indexes every intact record. Anything after the first bad one can only be
+// a write that never completed, so in the active segment it is cut off.
+void MatchHistory::loadSegment(std::size_t segment, bool last) {
+    const int fd = segments[segment];
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        throw std::runtime_error("Failed to stat history segment: " + std::string(std::strerror(errno)));
+    }
+    std::string data(static_cast<std::size_t>(info.st_size), '\0');
+    if (!data.empty() && !readAt(fd, &data[0], data.size(), 0)) {
+        throw std::runtime_error("Failed to read history segment: " + std::string(std::strerror(errno)));
+    }
+
+    std::uint64_t offset = 0;
+    MatchRecord record;
+    Header header;
+    while (offset + HEADER_SIZE <= data.size() && readHeader(data.data() + offset, header)) {
+        const std::uint64_t end = offset + HEADER_SIZE + header.length;
+        if (end > data.size()) break;
+        std::string_view payload(data.data() + offset + HEADER_SIZE, header.length);
+        if (checksum(payload) != header.checksum || !decodePayload(payload, record)) break;
+
+        index(header.matchId, {segment, offset, static_cast<std::uint32_t>(end - offset)}, record.players);
+        offset = end;
+    }
+
+    if (offset < data.size()) {
+        std::cerr << "Match history: " << (data.size() - offset) << " unreadable bytes at the end of "
+                  << segmentPath(directory, nextSegmentNumber - 1) << std::endl;
+        if (last && !readOnly && ::ftruncate(fd, static_cast<off_t>(offset)) != 0) {
+            throw std::runtime_error("Failed to truncate history segment: " + std::string(std::strerror(errno)));
+        }
+    }
+    if (last) activeSize = offset;
+}
+
+void MatchHistory::openSegment(std::uint32_t number) {
+    const std::string path = segmentPath(directory, number);
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to create " + path + ": " + std::strerror(errno));
+    }
+    // The new file name must survive a crash as well as its contents.
+    int dir = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir >= 0) {
+        ::fsync(dir);
+        ::close(dir);
+    }
+
+    std::lock_guard<std::mutex> lock(indexMutex);
+    segments.push_back(fd);
+    nextSegmentNumber = number + 1;
+    activeSize = 0;
+}
+
+// Caller holds indexMutex, or is the constructor.
+void MatchHistory::index(std::uint64_t matchId, const Location& location,
+                         const std::array<std::string, 2>& players) {
+    const bool added = byMatch.insert_or_assign(matchId, location).second;
+    if (added) {
+        byPlayer[players[0]].push_back(matchId);
+        if (players[1] != players[0]) {
+            byPlayer[players[1]].push_back(matchId);
+        }
+    }
+    lastMatchId = std::max(lastMatchId, matchId);
+}
+
+// Group commit: whatever queued while the previous batch was syncing goes
+// out as one write followed by one fdatasync.
+void MatchHistory::run() {
+    std::string batch;
+    std::vector<Pending> batchIndex;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            wake.wait(lock, [this] { return stopping || !queued.empty(); });
+            if (queued.empty()) return;
+            batch.swap(queued);
+            batchIndex.swap(queuedIndex);
+        }
+        progress.notify_all();
+
+        try {
+            if (activeSize >= SEGMENT_BYTES) openSegment(nextSegmentNumber);
+        } catch (const std::exception& e) {
+            std::cerr << "Match history: " << e.what() << std::endl;
+        }
+
+        const int fd = segments.back();
+        const std::uint64_t base = activeSize;
+        if (writeAll(fd, batch.data(), batch.size()) && ::fdatasync(fd) == 0) {
+            activeSize += batch.size();
+            std::lock_guard<std::mutex> lock(indexMutex);
+            for (const auto& pending : batchIndex) {
+                index(pending.matchId, {segments.size() - 1, base + pending.offset, pending.length},
+                      pending.players);
+            }
+        } else {
+            std::cerr << "Match history: lost " << batchIndex.size() << " records: "
+                      << std::strerror(errno) << std::endl;
+            // Keep the segment parseable for the next batch.
+            if (::ftruncate(fd, static_cast<off_t>(base)) != 0) {
+                std::cerr << "Match history: failed to truncate segment" << std::endl;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            syncedCount += batchIndex.size();
+        }
+        progress.notify_all();
+        batch.clear();
+        batchIndex.clear();
+    }
+}
@@ -0,0 +1,540 @@
+#include "../include/Server/MatchServer.h"
+#include "../include/Server/Socket.h"
+#include "../include/Utils/CardUtils.h"
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace {
+    constexpr std::uint64_t LISTEN_TOKEN = 0;
+    constexpr std::uint64_t WAKE_TOKEN = ~std::uint64_t(0);
+    constexpr int MAX_EVENTS = 256;
+
+    // A client that sends this much without a complete request, or stops
+    // reading this much output, is dropped.
+    constexpr std::size_t MAX_BUFFERED = 4 * 1024 * 1024;
+
+    // Reads the optional pair of deck factions that follows the player names.
+    bool readFactions(std::istream& in, std::array<Faction, 2>& factions) {
+        std::array<std::string, 2> names;
+        if (!(in >> names[0])) return true;
+        if (!(in >> names[1])) return false;
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            factions[i] = CardUtils::enumFromString<Faction>(names[i]);
+            if (factions[i] == Faction::NEUTRAL && names[i] != "NEUTRAL") return false;
+        }
+        return true;
+    }
+}
+
+MatchServer::MatchServer(const std::string& deckFile, unsigned shardCount,
+                         const std::string& historyDir) {
+    std::ifstream file(deckFile);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + deckFile);
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    deckJson = contents.str();
+    catalog.load(deckJson);
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (epollFd < 0 || wakeFd < 0) {
+        throw std::runtime_error("Failed to create event loop");
+    }
+    epoll_event wake{};
+    wake.events = EPOLLIN;
+    wake.data.u64 = WAKE_TOKEN;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &wake);
+
+    if (shardCount == 0) shardCount = 1;
+    std::uint64_t firstLocalId = 0;
+    if (!historyDir.empty()) {
+        history = std::make_unique<MatchHistory>(historyDir);
+        if (history->size() > 0) firstLocalId = history->getLastMatchId() / shardCount + 1;
+    }
+
+    shards.reserve(shardCount);
+    for (unsigned i = 0; i < shardCount; ++i) {
+        shards.push_back(std::make_unique<MatchShard>(
+            i, shardCount, deckJson, catalog,
+            [this](std::vector<MatchReply>& replies) { deliver(replies); },
+            history.get(), firstLocalId));
+        shards.back()->start();
+    }
+}
+
+MatchServer::~MatchServer() {
+    stop();
+    // Shards call back into deliver(), so they go before anything it touches.
+    for (auto& shard : shards) {
+        shard->stop();
+    }
+    for (auto& entry : connections) {
+        Net::closeSocket(entry.second->fd);
+    }
+    Net::closeSocket(listenFd);
+    Net::closeSocket(wakeFd);
+    Net::closeSocket(epollFd);
+}
+
+void MatchServer::listen(unsigned short port) {
+    listenFd = Net::listenTcp(port);
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = LISTEN_TOKEN;
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event) < 0) {
+        throw std::runtime_error("Failed to watch listening socket");
+    }
+    running = true;
+}
+
+void MatchServer::stop() {
+    running = false;
+    std::uint64_t one = 1;
+    ssize_t ignored = write(wakeFd, &one, sizeof(one));
+    (void)ignored;
+}
+
+void MatchServer::run() {
+    epoll_event events[MAX_EVENTS];
+    while (running) {
+        int count = epoll_wait(epollFd, events, MAX_EVENTS, -1);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            std::cerr << "epoll_wait failed\n";
+            break;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            const std::uint64_t token = events[i].data.u64;
+            if (token == LISTEN_TOKEN) {
+                acceptClients();
+                continue;
+            }
+            if (token == WAKE_TOKEN) {
+                drainCompleted();
+                continue;
+            }
+
+            auto it = connections.find(token);
+            if (it == connections.end()) continue;
+            Connection& connection = *it->second;
+
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                closeConnection(connection);
+                continue;
+            }
+            if (events[i].events & EPOLLIN) {
+                onReadable(connection);
+            }
+            if ((events[i].events & EPOLLOUT) && connections.count(token)) {
+                dirty.push_back(token);
+            }
+        }
+
+        // Everything that became ready during this wake-up leaves in one
+        // send per connection.
+        flushDirty();
+    }
+}
+
+void MatchServer::acceptClients() {
+    for (;;) {
+        int fd = Net::acceptClient(listenFd);
+        if (fd < 0) return;
+
+        auto connection = std::make_unique<Connection>();
+        connection->fd = fd;
+        connection->id = nextConnectionId++;
+        connection->input = buffers.acquire();
+
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u64 = connection->id;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            Net::closeSocket(fd);
+            continue;
+        }
+        connections.emplace(connection->id, std::move(connection));
+    }
+}
+
+void MatchServer::onReadable(Connection& connection) {
+    Net::IoStatus status = Net::readAvailable(connection.fd, connection.input);
+
+    if (connection.mode == Mode::UNKNOWN && !connection.input.empty()) {
+        connection.mode = static_cast<std::uint8_t>(connection.input[0]) == Protocol::MAGIC
+                              ? Mode::BINARY : Mode::TEXT;
+    }
+    if (connection.mode == Mode::BINARY) {
+        parseBinary(connection);
+    } else if (connection.mode == Mode::TEXT) {
+        parseText(connection);
+    }
+
+    if (status == Net::IoStatus::CLOSED || connection.input.size() > MAX_BUFFERED) {
+        closeConnection(connection);
+    }
+}
+
+void MatchServer::parseText(Connection& connection) {
+    std::size_t start = 0;
+    std::size_t end;
+    std::string line;
+    while (!connection.closing && (end = connection.input.find('\n', start)) != std::string::npos) {
+        line.assign(connection.input, start, end - start);
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        handleLine(connection, line);
+        start = end + 1;
+    }
+    connection.input.erase(0, start);
+}
+
+void MatchServer::parseBinary(Connection& connection) {
+    std::size_t offset = 0;
+    std::size_t consumed = 0;
+    while (!connection.closing) {
+        auto status = Protocol::decode(std::string_view(connection.input).substr(offset),
+                                       message, consumed);
+        if (status == Protocol::DecodeStatus::INCOMPLETE) break;
+        if (status == Protocol::DecodeStatus::MALFORMED) {
+            respondError(connection, 0, "Malformed frame");
+            connection.closing = true;
+            offset = connection.input.size();
+            break;
+        }
+        handleMessage(connection, message);
+        offset += consumed;
+    }
+    connection.input.erase(0, offset);
+}
+
+void MatchServer::handleLine(Connection& connection, const std::string& line) {
+    std::istringstream in(line);
+    std::string command;
+    in >> command;
+
+    MatchRequest request;
+    if (command == "NEW") {
+        request.type = MatchRequest::Type::CREATE;
+        if (!(in >> request.player1 >> request.player2) || !readFactions(in, request.factions)) {
+            respond(connection, "ERR Usage: NEW <name1> <name2> [<faction1> <faction2>]");
+            return;
+        }
+        submit(connection, nextShard++ % shards.size(), std::move(request));
+        return;
+    }
+    if (command == "STATS") {
+        std::size_t live = 0;
+        std::uint64_t finished = 0;
+        for (const auto& shard : shards) {
+            live += shard->getMatchCount();
+            finished += shard->getFinishedCount();
+        }
+        respond(connection, "OK " + std::to_string(live) + " " + std::to_string(finished));
+        return;
+    }
+
+    bool valid = true;
+    if (command == "PLAY") {
+        request.type = MatchRequest::Type::PLAY;
+        valid = static_cast<bool>(in >> request.matchId >> request.playerId >> request.index);
+    } else if (command == "PASS") {
+        request.type = MatchRequest::Type::PASS;
+        valid = static_cast<bool>(in >> request.matchId >> request.playerId);
+    } else if (command == "JOIN") {
+        request.type = MatchRequest::Type::JOIN;
+        valid = static_cast<bool>(in >> request.matchId);
+    } else if (command == "STATE" || command == "END") {
+        request.type = command == "STATE" ? MatchRequest::Type::STATE : MatchRequest::Type::CLOSE;
+        valid = static_cast<bool>(in >> request.matchId);
+    } else {
+        respond(connection, "ERR Unknown command");
+        return;
+    }
+
+    if (!valid) {
+        respond(connection, "ERR Malformed " + command);
+        return;
+    }
+    submit(connection, static_cast<unsigned>(request.matchId % shards.size()), std::move(request));
+}
+
+void MatchServer::handleMessage(Connection& connection, const Protocol::Message& request) {
+    MatchRequest match;
+    match.binary = true;
+    match.matchId = request.matchId;
+    match.playerId = request.player;
+    match.index = static_cast<int>(request.index);
+
+    switch (request.type) {
+        case Protocol::MessageType::NEW_MATCH: {
+            match.type = MatchRequest::Type::CREATE;
+            std::istringstream names(request.text);
+            names >> match.player1 >> match.player2;
+            if (!readFactions(names, match.factions)) {
+                respondError(connection, request.matchId, "Unknown deck faction");
+                return;
+            }
+            submit(connection, nextShard++ % shards.size(), std::move(match));
+            return;
+        }
+        case Protocol::MessageType::PLAY:
+            match.type = MatchRequest::Type::PLAY;
+            break;
+        case Protocol::MessageType::PASS:
+            match.type = MatchRequest::Type::PASS;
+            break;
+        case Protocol::MessageType::JOIN_MATCH:
+            match.type = MatchRequest::Type::JOIN;
+            break;
+        case Protocol::MessageType::END_MATCH:
+            match.type = MatchRequest::Type::CLOSE;
+            break;
+        case Protocol::MessageType::SPECTATE:
+            match.type = MatchRequest::Type::SPECTATE;
+            break;
+        default:
+            respondError(connection, request.matchId, "Unexpected message type");
+            return;
+    }
+    submit(connection, static_cast<unsigned>(match.matchId % shards.size()), std::move(match));
+}
+
+// Every request reserves its reply slot up front so replies leave in
+// request order even when shards finish out of order.
+void MatchServer::submit(Connection& connection, unsigned shard, MatchRequest request) {
+    if (request.type == MatchRequest::Type::CLOSE) {
+        auto& seats = connection.seats;
+        seats.erase(std::remove(seats.begin(), seats.end(), request.matchId), seats.end());
+    }
+    request.connection = connection.id;
+    request.sequence = connection.firstSequence + connection.replies.size();
+    connection.replies.emplace_back();
+    shards[shard]->post(std::move(request));
+}
+
+void MatchServer::respond(Connection& connection, std::string data) {
+    const std::uint64_t sequence = connection.firstSequence + connection.replies.size();
+    connection.replies.emplace_back();
+    if (connection.mode == Mode::TEXT) data += '\n';
+    complete(connection, sequence, std::make_shared<const std::string>(std::move(data)));
+}
+
+void MatchServer::respondError(Connection& connection, std::uint64_t matchId, const std::string& reason) {
+    Protocol::Message error;
+    error.matchId = matchId;
+    error.text = reason;
+    std::string frame;
+    Protocol::encode(error, frame);
+    respond(connection, std::move(frame));
+}
+
+void MatchServer::deliver(std::vector<MatchReply>& replies) {
+    bool wasEmpty;
+    {
+        std::lock_guard<std::mutex> lock(completedMutex);
+        wasEmpty = completed.empty();
+        if (wasEmpty) {
+            completed.swap(replies);
+        } else {
+            for (auto& reply : replies) {
+                completed.push_back(std::move(reply));
+            }
+        }
+    }
+    // One wake-up covers every batch delivered before the reactor drains.
+    if (wasEmpty) {
+        std::uint64_t one = 1;
+        ssize_t ignored = write(wakeFd, &one, sizeof(one));
+        (void)ignored;
+    }
+}
+
+void MatchServer::drainCompleted() {
+    std::uint64_t counter;
+    ssize_t ignored = read(wakeFd, &counter, sizeof(counter));
+    (void)ignored;
+
+    {
+        std::lock_guard<std::mutex> lock(completedMutex);
+        draining.swap(completed);
+    }
+    for (auto& reply : draining) {
+        if (reply.kind == MatchReply::Kind::BROADCAST ||
+            reply.kind == MatchReply::Kind::FINAL_BROADCAST) {
+            fanOut(reply);
+            continue;
+        }
+
+        auto it = connections.find(reply.connection);
+        if (it == connections.end()) {
+            // The client left before its answer arrived; undo what it got.
+            if (reply.kind == MatchReply::Kind::WATCH) {
+                MatchRequest request;
+                request.type = MatchRequest::Type::UNWATCH;
+                request.matchId = reply.matchId;
+                shards[reply.matchId % shards.size()]->post(std::move(request));
+            } else if (reply.kind == MatchReply::Kind::SEATED) {
+                closeMatch(reply.connection, reply.matchId);
+            }
+            continue;
+        }
+        Connection& connection = *it->second;
+        complete(connection, reply.sequence, std::move(reply.data));
+
+        if (reply.kind == MatchReply::Kind::SEATED) {
+            connection.seats.push_back(reply.matchId);
+        }
+
+        // Following starts only now, so broadcasts the shard produced before
+        // the snapshot (and already folded into it) are not sent again.
+        if (reply.kind == MatchReply::Kind::WATCH) {
+            spectators[reply.matchId].push_back(connection.id);
+            connection.watching.push_back(reply.matchId);
+        }
+    }
+    draining.clear();
+}
+
+void MatchServer::complete(Connection& connection, std::uint64_t sequence, SharedFrame data) {
+    PendingReply& slot = connection.replies[sequence - connection.firstSequence];
+    slot.data = std::move(data);
+    slot.ready = true;
+
+    if (sequence == connection.firstSequence) {
+        dirty.push_back(connection.id);
+    }
+}
+
+void MatchServer::fanOut(const MatchReply& reply) {
+    auto it = spectators.find(reply.matchId);
+    if (it == spectators.end()) return;
+
+    for (std::uint64_t id : it->second) {
+        auto connection = connections.find(id);
+        if (connection != connections.end()) {
+            enqueue(*connection->second, reply.data);
+        }
+    }
+
+    if (reply.kind == MatchReply::Kind::FINAL_BROADCAST) {
+        for (std::uint64_t id : it->second) {
+            auto connection = connections.find(id);
+            if (connection == connections.end()) continue;
+            auto& watching = connection->second->watching;
+            watching.erase(std::remove(watching.begin(), watching.end(), reply.matchId), watching.end());
+        }
+        spectators.erase(it);
+    }
+}
+
+// Pushed frames queue behind replies that are still outstanding so a
+// spectator that is also playing never sees them out of order.
+void MatchServer::enqueue(Connection& connection, const SharedFrame& frame) {
+    if (connection.replies.empty()) {
+        connection.outbound.push_back(frame);
+        connection.outboundBytes += frame->size();
+        dirty.push_back(connection.id);
+    } else {
+        connection.replies.push_back({frame, true});
+    }
+}
+
+void MatchServer::unwatchAll(Connection& connection) {
+    for (std::uint64_t matchId : connection.watching) {
+        auto it = spectators.find(matchId);
+        if (it != spectators.end()) {
+            auto& ids = it->second;
+            ids.erase(std::remove(ids.begin(), ids.end(), connection.id), ids.end());
+            if (ids.empty()) spectators.erase(it);
+        }
+
+        MatchRequest request;
+        request.type = MatchRequest::Type::UNWATCH;
+        request.matchId = matchId;
+        shards[matchId % shards.size()]->post(std::move(request));
+    }
+    connection.watching.clear();
+}
+
+void MatchServer::leaveAll(Connection& connection) {
+    for (std::uint64_t matchId : connection.seats) {
+        closeMatch(connection.id, matchId);
+    }
+    connection.seats.clear();
+}
+
+// Ends a match on behalf of a seat holder that is gone. Its reply finds no
+// connection and is dropped; a match already ended just answers with an error.
+void MatchServer::closeMatch(std::uint64_t connection, std::uint64_t matchId) {
+    MatchRequest request;
+    request.type = MatchRequest::Type::CLOSE;
+    request.matchId = matchId;
+    request.connection = connection;
+    shards[matchId % shards.size()]->post(std::move(request));
+}
+
+void MatchServer::flushDirty() {
+    for (std::uint64_t id : dirty) {
+        auto it = connections.find(id);
+        if (it != connections.end()) {
+            flush(*it->second);
+        }
+    }
+    dirty.clear();
+}
+
+void MatchServer::flush(Connection& connection) {
+    while (!connection.replies.empty() && connection.replies.front().ready) {
+        connection.outboundBytes += connection.replies.front().data->size();
+        connection.outbound.push_back(std::move(connection.replies.front().data));
+        connection.replies.pop_front();
+        ++connection.firstSequence;
+    }
+
+    Net::IoStatus status = Net::writeQueued(connection.fd, connection.outbound, connection.outboundOffset);
+    connection.outboundBytes = 0;
+    for (const auto& frame : connection.outbound) {
+        connection.outboundBytes += frame->size();
+    }
+    // A spectator that stops reading is dropped rather than buffered forever.
+    if (status == Net::IoStatus::CLOSED || connection.outboundBytes > MAX_BUFFERED) {
+        closeConnection(connection);
+        return;
+    }
+    if (connection.closing && connection.outbound.empty() && connection.replies.empty()) {
+        closeConnection(connection);
+        return;
+    }
+    watchWrites(connection, status == Net::IoStatus::WOULD_BLOCK);
+}
+
+void MatchServer::watchWrites(Connection& connection, bool enable) {
+    if (connection.watchingWrites == enable) return;
+    connection.watchingWrites = enable;
+
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLRDHUP | (enable ? static_cast<std::uint32_t>(EPOLLOUT) : 0u);
+    event.data.u64 = connection.id;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, connection.fd, &event);
+}
+
+void MatchServer::closeConnection(Connection& connection) {
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+    Net::closeSocket(connection.fd);
+    unwatchAll(connection);
+    leaveAll(connection);
+    buffers.release(std::move(connection.input));
+    // Replies still in flight find no connection and are dropped.
+    connections.erase(connection.id);
+}
@@ -0,0 +1,292 @@
+#include "../include/Server/MatchShard.h"
+#include "../include/Core/Game.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <sstream>
+
+namespace {
+    // A NEUTRAL deck holds every faction, so the history records the one
+    // that dominates its opening hand instead.
+    Faction deckFaction(const Player& player) {
+        if (player.getDeck() && player.getDeck()->getFaction() != Faction::NEUTRAL) {
+            return player.getDeck()->getFaction();
+        }
+        std::array<int, 5> counts{};
+        for (const auto& card : player.getHand()) {
+            const auto faction = static_cast<std::size_t>(card->getFaction());
+            if (faction < counts.size() && card->getFaction() != Faction::NEUTRAL) {
+                ++counts[faction];
+            }
+        }
+        auto best = std::max_element(counts.begin(), counts.end());
+        return *best > 0 ? static_cast<Faction>(best - counts.begin()) : Faction::NEUTRAL;
+    }
+}
+
+MatchShard::MatchShard(unsigned index, unsigned shardCount, const std::string& deckJson,
+                       const CardCatalog& catalog, ReplyHandler onReplies,
+                       MatchHistory* history, std::uint64_t firstLocalId)
+    : index(index), shardCount(shardCount), deckJson(deckJson), catalog(catalog),
+      onReplies(std::move(onReplies)), history(history), nextLocalId(firstLocalId) {}
+
+MatchShard::~MatchShard() {
+    stop();
+}
+
+void MatchShard::start() {
+    if (thread.joinable()) return;
+    thread = std::thread(&MatchShard::run, this);
+}
+
+void MatchShard::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (thread.joinable()) thread.join();
+}
+
+void MatchShard::post(MatchRequest request) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(request));
+    }
+    wake.notify_one();
+}
+
+void MatchShard::run() {
+    std::vector<MatchRequest> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (stopping && queue.empty()) return;
+            batch.swap(queue);
+        }
+
+        for (auto& request : batch) {
+            std::string reply;
+            seated = false;
+            try {
+                reply = handle(request);
+            } catch (const std::exception& e) {
+                reply = errorReply(request, e.what());
+            }
+            if (request.type == MatchRequest::Type::UNWATCH) continue;
+            if (!request.binary) reply += '\n';
+
+            MatchReply::Kind kind = MatchReply::Kind::REPLY;
+            if (seated) {
+                kind = MatchReply::Kind::SEATED;
+            } else if (request.type == MatchRequest::Type::SPECTATE && matches.count(request.matchId)) {
+                kind = MatchReply::Kind::WATCH;
+            }
+            outgoing.push_back({kind, request.connection, request.sequence, request.matchId,
+                                std::make_shared<const std::string>(std::move(reply))});
+        }
+        batch.clear();
+
+        onReplies(outgoing);
+        outgoing.clear();
+    }
+}
+
+std::string MatchShard::handle(MatchRequest& request) {
+    if (request.type == MatchRequest::Type::CREATE) {
+        return createMatch(request);
+    }
+
+    auto it = matches.find(request.matchId);
+    if (it == matches.end()) {
+        return errorReply(request, "Unknown match " + std::to_string(request.matchId));
+    }
+    Match& match = it->second;
+    Game& game = *match.game;
+
+    if (request.type == MatchRequest::Type::PLAY || request.type == MatchRequest::Type::PASS) {
+        if (request.playerId < 0 || request.playerId > 1 ||
+            match.seats[request.playerId] != request.connection) {
+            return errorReply(request, "Seat " + std::to_string(request.playerId) + " is not yours");
+        }
+    }
+    if (request.type == MatchRequest::Type::CLOSE &&
+        match.seats[0] != request.connection && match.seats[1] != request.connection) {
+        return errorReply(request, "Not your match");
+    }
+
+    switch (request.type) {
+        case MatchRequest::Type::JOIN:
+            return join(request, match);
+        case MatchRequest::Type::PLAY:
+            game.playCard(request.playerId, request.index);
+            game.update(0.f);
+            match.moves.push_back({static_cast<std::uint8_t>(request.playerId), false,
+                                   static_cast<std::uint32_t>(request.index)});
+            broadcast(request.matchId, match);
+            break;
+        case MatchRequest::Type::PASS:
+            game.pass(request.playerId);
+            game.update(0.f);
+            match.moves.push_back({static_cast<std::uint8_t>(request.playerId), true, 0});
+            broadcast(request.matchId, match);
+            break;
+        case MatchRequest::Type::SPECTATE:
+            return spectate(request.matchId, match);
+        case MatchRequest::Type::UNWATCH:
+            if (match.spectators > 0) --match.spectators;
+            return {};
+        case MatchRequest::Type::CLOSE: {
+            if (game.isGameOver()) {
+                finishedCount.fetch_add(1, std::memory_order_relaxed);
+                if (history) archive(request.matchId, match);
+            }
+            const bool watched = match.spectators > 0;
+            matches.erase(it);
+            matchCount.store(matches.size(), std::memory_order_relaxed);
+
+            frame.clear();
+            frame.type = Protocol::MessageType::MATCH_CLOSED;
+            frame.matchId = request.matchId;
+            if (watched) {
+                outgoing.push_back({MatchReply::Kind::FINAL_BROADCAST, 0, 0, request.matchId,
+                                    std::make_shared<const std::string>(encodeFrame())});
+            }
+            return request.binary ? encodeFrame() : "OK";
+        }
+        default:
+            break;
+    }
+    return stateReply(request.matchId, request.playerId, request.binary, match);
+}
+
+// A new spectator gets the whole public state from a fresh shadow. The shared
+// shadow is brought up to date when the first spectator arrives, so the
+// broadcasts that follow continue from exactly that state.
+std::string MatchShard::spectate(std::uint64_t matchId, Match& match) {
+    frame.clear();
+    if (match.spectators++ == 0) {
+        match.publicShadow.diff(*match.game, catalog, frame.deltas);
+        frame.deltas.clear();
+    }
+
+    MatchShadow snapshot;
+    frame.type = Protocol::MessageType::MATCH_STATE;
+    frame.matchId = matchId;
+    snapshot.diff(*match.game, catalog, frame.deltas);
+    return encodeFrame();
+}
+
+void MatchShard::broadcast(std::uint64_t matchId, Match& match) {
+    if (match.spectators == 0) return;
+
+    frame.clear();
+    frame.type = Protocol::MessageType::MATCH_STATE;
+    frame.matchId = matchId;
+    match.publicShadow.diff(*match.game, catalog, frame.deltas);
+    if (frame.deltas.empty()) return;
+
+    outgoing.push_back({MatchReply::Kind::BROADCAST, 0, 0, matchId,
+                        std::make_shared<const std::string>(encodeFrame())});
+}
+
+std::string MatchShard::createMatch(MatchRequest& request) {
+    auto game = std::make_unique<Game>(request.player1, request.player2);
+    // Narrating thousands of matches would be all the server did; the
+    // players learn what happened from the state replies instead.
+    game->setOutput(nullptr);
+    std::istringstream deck(deckJson);
+    game->loadDeck(deck, request.factions[0], request.factions[1]);
+    game->startGame();
+
+    // Ids are interleaved across shards so the server can route by id alone.
+    const std::uint64_t id = nextLocalId++ * shardCount + index;
+    Match& match = matches[id];
+    match.game = std::move(game);
+    match.factions = {deckFaction(match.game->getPlayer(0)),
+                      deckFaction(match.game->getPlayer(1))};
+    match.seats = {request.connection, request.connection};
+    matchCount.store(matches.size(), std::memory_order_relaxed);
+
+    // The reply carries the new id so the server can record the seats.
+    request.matchId = id;
+    seated = true;
+
+    if (!request.binary) {
+        return "OK " + std::to_string(id) + " " + describeMatch(*match.game);
+    }
+    return stateReply(id, 0, true, match);
+}
+
+// Seat 1 can change hands once, and only before it has moved, so a move
+// already made for the creator is never attributed to the joiner.
+std::string MatchShard::join(const MatchRequest& request, Match& match) {
+    const bool moved = std::any_of(match.moves.begin(), match.moves.end(),
+                                   [](const MatchRecord::Move& move) { return move.player == 1; });
+    if (match.seats[0] != match.seats[1] || match.seats[0] == request.connection || moved) {
+        return errorReply(request, "Seat 1 is taken");
+    }
+    // The joiner starts from nothing, so its first answer is the whole state.
+    match.seats[1] = request.connection;
+    match.shadows[1] = MatchShadow(1);
+    seated = true;
+    return stateReply(request.matchId, 1, request.binary, match);
+}
+
+void MatchShard::archive(std::uint64_t matchId, Match& match) {
+    const Game& game = *match.game;
+    MatchRecord record;
+    record.matchId = matchId;
+    record.finishedAt = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    record.seed = game.getSeed();
+    record.players = {game.getPlayer(0).getName(), game.getPlayer(1).getName()};
+    record.factions = match.factions;
+    record.roundScores = game.getRoundScores();
+    record.moves = std::move(match.moves);
+    history->append(record);
+}
+
+std::string MatchShard::stateReply(std::uint64_t matchId, int seat, bool binary, Match& match) {
+    if (!binary) {
+        return "OK " + describeMatch(*match.game);
+    }
+
+    frame.clear();
+    frame.type = Protocol::MessageType::MATCH_STATE;
+    frame.matchId = matchId;
+    match.shadows[seat & 1].diff(*match.game, catalog, frame.deltas);
+    return encodeFrame();
+}
+
+std::string MatchShard::errorReply(const MatchRequest& request, const std::string& reason) {
+    if (!request.binary) {
+        return "ERR " + reason;
+    }
+
+    frame.clear();
+    frame.type = Protocol::MessageType::ERROR;
+    frame.matchId = request.matchId;
+    frame.text = reason;
+    return encodeFrame();
+}
+
+std::string MatchShard::encodeFrame() const {
+    std::string out;
+    Protocol::encode(frame, out);
+    return out;
+}
+
+std::string describeMatch(const Game& game) {
+    const Player& p0 = game.getPlayer(0);
+    const Player& p1 = game.getPlayer(1);
+
+    std::string summary;
+    summary.reserve(32);
+    summary += std::to_string(game.getCurrentPlayerIndex());
+    summary += game.isGameOver() ? " 1 " : " 0 ";
+    summary += std::to_string(p0.getHandSize()) + " " + std::to_string(p1.getHandSize()) + " ";
+    summary += std::to_string(p0.getRoundsWon()) + " " + std::to_string(p1.getRoundsWon());
+    return summary;
+}
@@ -0,0 +1,227 @@
+#include "../include/Server/Protocol.h"
+#include "../include/Utils/Varint.h"
+
+namespace {
+    using namespace Protocol;
+    using namespace Varint;
+
+    bool isClientMessage(MessageType type) {
+        return type >= MessageType::NEW_MATCH && type <= MessageType::JOIN_MATCH;
+    }
+
+    bool isKnown(MessageType type) {
+        return isClientMessage(type) ||
+               (type >= MessageType::MATCH_STATE && type <= MessageType::MATCH_CLOSED);
+    }
+
+    void encodeDelta(const Delta& delta, std::string& out) {
+        out.push_back(static_cast<char>((static_cast<std::uint8_t>(delta.kind) << 2) | (delta.player & 3)));
+        switch (delta.kind) {
+            case DeltaKind::CARD_ADDED:
+                out.push_back(static_cast<char>(delta.zone));
+                putVarint(out, delta.slot);
+                putVarint(out, delta.card);
+                putSigned(out, delta.value);
+                break;
+            case DeltaKind::CARD_REMOVED:
+                out.push_back(static_cast<char>(delta.zone));
+                putVarint(out, delta.slot);
+                break;
+            case DeltaKind::HAND_CARD_ADDED:
+                putVarint(out, delta.slot);
+                putVarint(out, delta.card);
+                break;
+            case DeltaKind::HAND_CARD_REMOVED:
+                putVarint(out, delta.slot);
+                break;
+            case DeltaKind::POWER_CHANGED:
+                out.push_back(static_cast<char>(delta.zone));
+                putVarint(out, delta.slot);
+                putSigned(out, delta.value);
+                break;
+            case DeltaKind::WEATHER_SET:
+                out.push_back(static_cast<char>(delta.zone));
+                putSigned(out, delta.value);
+                break;
+            case DeltaKind::ROUND_END:
+            case DeltaKind::HAND_SIZE:
+                putSigned(out, delta.value);
+                break;
+            case DeltaKind::PASSED:
+            case DeltaKind::TURN:
+            case DeltaKind::GAME_OVER:
+                break;
+        }
+    }
+
+    bool decodeDelta(Reader& in, Delta& delta) {
+        std::uint8_t header = in.byte();
+        std::uint8_t kind = header >> 2;
+        if (kind > static_cast<std::uint8_t>(DeltaKind::HAND_CARD_REMOVED)) return false;
+
+        delta = Delta{static_cast<DeltaKind>(kind)};
+        delta.player = header & 3;
+        if (delta.player > 2) return false;
+
+        switch (delta.kind) {
+            case DeltaKind::CARD_ADDED:
+                delta.zone = in.byte();
+                delta.slot = in.varint32();
+                delta.card = in.varint32();
+                delta.value = in.signed32();
+                break;
+            case DeltaKind::CARD_REMOVED:
+                delta.zone = in.byte();
+                delta.slot = in.varint32();
+                break;
+            case DeltaKind::HAND_CARD_ADDED:
+                delta.slot = in.varint32();
+                delta.card = in.varint32();
+                break;
+            case DeltaKind::HAND_CARD_REMOVED:
+                delta.slot = in.varint32();
+                break;
+            case DeltaKind::POWER_CHANGED:
+                delta.zone = in.byte();
+                delta.slot = in.varint32();
+                delta.value = in.signed32();
+                break;
+            case DeltaKind::WEATHER_SET:
+                delta.zone = in.byte();
+                delta.value = in.signed32();
+                break;
+            case DeltaKind::ROUND_END:
+            case DeltaKind::HAND_SIZE:
+                delta.value = in.signed32();
+                break;
+            case DeltaKind::PASSED:
+            case DeltaKind::TURN:
+            case DeltaKind::GAME_OVER:
+                break;
+        }
+        return in.ok() && delta.zone < 3;
+    }
+}
+
+bool Protocol::Delta::operator==(const Delta& other) const {
+    return kind == other.kind && player == other.player && zone == other.zone &&
+           slot == other.slot && card == other.card && value == other.value;
+}
+
+void Protocol::Message::clear() {
+    type = MessageType::ERROR;
+    matchId = 0;
+    player = 0;
+    index = 0;
+    text.clear();
+    deltas.clear();
+}
+
+void Protocol::encode(const Message& message, std::string& out) {
+    std::string payload;
+    switch (message.type) {
+        case MessageType::NEW_MATCH:
+            putVarint(payload, message.text.size());
+            payload += message.text;
+            break;
+        case MessageType::PLAY:
+            putVarint(payload, message.matchId);
+            payload.push_back(static_cast<char>(message.player));
+            putVarint(payload, message.index);
+            break;
+        case MessageType::PASS:
+            putVarint(payload, message.matchId);
+            payload.push_back(static_cast<char>(message.player));
+            break;
+        case MessageType::END_MATCH:
+        case MessageType::SPECTATE:
+        case MessageType::JOIN_MATCH:
+        case MessageType::MATCH_CLOSED:
+            putVarint(payload, message.matchId);
+            break;
+        case MessageType::MATCH_STATE:
+            putVarint(payload, message.matchId);
+            putVarint(payload, message.deltas.size());
+            for (const auto& delta : message.deltas) {
+                encodeDelta(delta, payload);
+            }
+            break;
+        case MessageType::ERROR:
+            putVarint(payload, message.matchId);
+            putVarint(payload, message.text.size());
+            payload += message.text;
+            break;
+    }
+
+    out.push_back(static_cast<char>(MAGIC));
+    out.push_back(static_cast<char>(VERSION));
+    out.push_back(static_cast<char>(message.type));
+    putVarint(out, payload.size());
+    out += payload;
+}
+
+Protocol::DecodeStatus Protocol::decode(std::string_view buffer, Message& message, std::size_t& consumed) {
+    Reader header(buffer);
+    if (header.byte() != MAGIC) return header.ok() ? DecodeStatus::MALFORMED : DecodeStatus::INCOMPLETE;
+    std::uint8_t version = header.byte();
+    std::uint8_t type = header.byte();
+    std::uint64_t length = header.varint();
+    if (!header.ok()) {
+        // A truncated header is only incomplete if what we have is still plausible.
+        return buffer.size() < 13 ? DecodeStatus::INCOMPLETE : DecodeStatus::MALFORMED;
+    }
+    if (version != VERSION || !isKnown(static_cast<MessageType>(type)) || length > MAX_PAYLOAD) {
+        return DecodeStatus::MALFORMED;
+    }
+
+    const std::size_t headerSize = header.offset();
+    if (buffer.size() - headerSize < length) return DecodeStatus::INCOMPLETE;
+
+    Reader in(buffer.substr(headerSize, static_cast<std::size_t>(length)));
+    message.clear();
+    message.type = static_cast<MessageType>(type);
+
+    switch (message.type) {
+        case MessageType::NEW_MATCH: {
+            std::uint64_t size = in.varint();
+            message.text = std::string(in.bytes(static_cast<std::size_t>(size)));
+            break;
+        }
+        case MessageType::PLAY:
+            message.matchId = in.varint();
+            message.player = in.byte();
+            message.index = in.varint32();
+            break;
+        case MessageType::PASS:
+            message.matchId = in.varint();
+            message.player = in.byte();
+            break;
+        case MessageType::END_MATCH:
+        case MessageType::SPECTATE:
+        case MessageType::JOIN_MATCH:
+        case MessageType::MATCH_CLOSED:
+            message.matchId = in.varint();
+            break;
+        case MessageType::MATCH_STATE: {
+            message.matchId = in.varint();
+            std::uint64_t count = in.varint();
+            // Every delta takes at least one byte, which bounds the reservation.
+            if (count > length) return DecodeStatus::MALFORMED;
+            message.deltas.resize(static_cast<std::size_t>(count));
+            for (auto& delta : message.deltas) {
+                if (!decodeDelta(in, delta)) return DecodeStatus::MALFORMED;
+            }
+            break;
+        }
+        case MessageType::ERROR: {
+            message.matchId = in.varint();
+            std::uint64_t size = in.varint();
+            message.text = std::string(in.bytes(static_cast<std::size_t>(size)));
+            break;
+        }
+    }
+
+    if (!in.ok() || !in.atEnd() || message.player > 1) return DecodeStatus::MALFORMED;
+    consumed = headerSize + static_cast<std::size_t>(length);
+    return DecodeStatus::OK;
+}
@@ -0,0 +1,29 @@
+#include "../include/Server/MatchServer.h"
+#include "../include/Server/Socket.h"
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+// gwent_server [port] [shards] [deck.json] [historyDir]
+int main(int argc, char* argv[]) {
+    const unsigned short port = argc > 1 ? static_cast<unsigned short>(std::atoi(argv[1])) : 7777;
+    const unsigned hardware = std::thread::hardware_concurrency();
+    const unsigned shards = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2]))
+                                     : (hardware ? hardware : 4);
+    const std::string deckFile = argc > 3 ? argv[3] : "../assets/cards.json";
+    const std::string historyDir = argc > 4 ? argv[4] : "";
+
+    try {
+        const std::size_t fileLimit = Net::raiseFileLimit();
+        MatchServer server(deckFile, shards, historyDir);
+        server.listen(port);
+        std::cerr << "gwent_server listening on port " << port << " with " << shards
+                  << " shards, up to " << fileLimit << " open sockets\n";
+        server.run();
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
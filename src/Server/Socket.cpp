@@ -0,0 +1,176 @@
+#include "../include/Server/Socket.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+    std::runtime_error socketError(const std::string& what) {
+        return std::runtime_error(what + ": " + std::strerror(errno));
+    }
+
+    void disableNagle(int fd) {
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+}
+
+int Net::listenTcp(unsigned short port, int backlog) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (fd < 0) throw socketError("socket");
+
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        close(fd);
+        throw socketError("bind to port " + std::to_string(port));
+    }
+    if (listen(fd, backlog) < 0) {
+        close(fd);
+        throw socketError("listen");
+    }
+    return fd;
+}
+
+int Net::connectTcp(const std::string& host, unsigned short port) {
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* results = nullptr;
+    const std::string service = std::to_string(port);
+    if (getaddrinfo(host.c_str(), service.c_str(), &hints, &results) != 0 || !results) {
+        throw std::runtime_error("Cannot resolve " + host);
+    }
+
+    int fd = socket(results->ai_family, results->ai_socktype, results->ai_protocol);
+    if (fd < 0) {
+        freeaddrinfo(results);
+        throw socketError("socket");
+    }
+    if (connect(fd, results->ai_addr, results->ai_addrlen) < 0) {
+        freeaddrinfo(results);
+        close(fd);
+        throw socketError("connect to " + host + ":" + service);
+    }
+    freeaddrinfo(results);
+
+    disableNagle(fd);
+    return fd;
+}
+
+int Net::acceptClient(int listenFd) {
+    for (;;) {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK);
+        if (fd >= 0) {
+            disableNagle(fd);
+            return fd;
+        }
+        if (errno == EINTR || errno == ECONNABORTED) continue;
+        return -1;
+    }
+}
+
+void Net::setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        throw socketError("fcntl");
+    }
+}
+
+void Net::closeSocket(int fd) {
+    if (fd >= 0) close(fd);
+}
+
+std::size_t Net::raiseFileLimit() {
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0) return 0;
+    if (limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+        getrlimit(RLIMIT_NOFILE, &limit);
+    }
+    return static_cast<std::size_t>(limit.rlim_cur);
+}
+
+Net::IoStatus Net::readAvailable(int fd, std::string& buffer) {
+    char chunk[16384];
+    for (;;) {
+        ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+        if (received > 0) {
+            buffer.append(chunk, static_cast<std::size_t>(received));
+            if (static_cast<std::size_t>(received) < sizeof(chunk)) return IoStatus::OK;
+            continue;
+        }
+        if (received == 0) return IoStatus::CLOSED;
+        if (errno == EINTR) continue;
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? IoStatus::WOULD_BLOCK : IoStatus::CLOSED;
+    }
+}
+
+Net::IoStatus Net::writePending(int fd, std::string& buffer) {
+    std::size_t offset = 0;
+    while (offset < buffer.size()) {
+        ssize_t sent = send(fd, buffer.data() + offset, buffer.size() - offset, MSG_NOSIGNAL);
+        if (sent >= 0) {
+            offset += static_cast<std::size_t>(sent);
+            continue;
+        }
+        if (errno == EINTR) continue;
+        buffer.erase(0, offset);
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? IoStatus::WOULD_BLOCK : IoStatus::CLOSED;
+    }
+    buffer.clear();
+    return IoStatus::OK;
+}
+
+Net::IoStatus Net::writeQueued(int fd, std::deque<std::shared_ptr<const std::string>>& queue,
+                               std::size_t& offset) {
+    constexpr std::size_t MAX_IOV = 64;
+    iovec parts[MAX_IOV];
+
+    while (!queue.empty()) {
+        std::size_t count = 0;
+        for (auto it = queue.begin(); it != queue.end() && count < MAX_IOV; ++it, ++count) {
+            const std::size_t skip = count == 0 ? offset : 0;
+            parts[count].iov_base = const_cast<char*>((*it)->data() + skip);
+            parts[count].iov_len = (*it)->size() - skip;
+        }
+
+        msghdr message{};
+        message.msg_iov = parts;
+        message.msg_iovlen = count;
+        ssize_t sent = sendmsg(fd, &message, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) continue;
+            return (errno == EAGAIN || errno == EWOULDBLOCK) ? IoStatus::WOULD_BLOCK : IoStatus::CLOSED;
+        }
+
+        std::size_t remaining = static_cast<std::size_t>(sent);
+        while (remaining > 0) {
+            const std::size_t left = queue.front()->size() - offset;
+            if (remaining < left) {
+                offset += remaining;
+                break;
+            }
+            remaining -= left;
+            queue.pop_front();
+            offset = 0;
+        }
+    }
+    return IoStatus::OK;
+}
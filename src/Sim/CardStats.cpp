@@ -0,0 +1,111 @@
+#include "../include/Sim/CardStats.h"
+#include "../include/Core/Game.h"
+#include "../include/Utils/CardUtils.h"
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+
+namespace {
+    double ratio(double total, std::uint64_t count) {
+        return count ? total / static_cast<double>(count) : 0.0;
+    }
+
+    double sortValue(const CardStats::Counters& c, CardStats::SortKey key) {
+        switch (key) {
+            case CardStats::SortKey::WIN_RATE: return ratio(static_cast<double>(c.wins), c.decidedPlays);
+            case CardStats::SortKey::CONTRIBUTION: return ratio(static_cast<double>(c.contribution), c.plays);
+            case CardStats::SortKey::PLAYS: return static_cast<double>(c.plays);
+            case CardStats::SortKey::EFFECT: return ratio(static_cast<double>(c.effectValue), c.plays);
+        }
+        return 0.0;
+    }
+}
+
+CardStats::CardStats(std::size_t cardCount) : counters(cardCount + 1) {}
+
+int CardStats::realizedEffect(const PlayEvent& play) {
+    switch (play.effect) {
+        case DeployEffect::DAMAGE_RANDOM_ENEMY:
+        case DeployEffect::DESTROY_WEAKEST:
+            return play.enemyLoss;
+        case DeployEffect::BOOST_ADJACENT:
+        case DeployEffect::MORALE_BOOST:
+        case DeployEffect::CLEAR_WEATHER:
+            return play.ownGain - play.power;
+        case DeployEffect::MEDIC:
+            return play.unitsAdded - 1;
+        case DeployEffect::DRAW_CARD:
+        case DeployEffect::SPY:
+            return play.cardsDrawn;
+        case DeployEffect::NONE:
+        default:
+            return 0;
+    }
+}
+
+// Unknown names map to catalog.size(), which is the last counter.
+void CardStats::onPlay(const PlayEvent& play) {
+    Counters& c = counters[std::min<std::size_t>(play.card, counters.size() - 1)];
+    c.effect = play.effect;
+    ++c.plays;
+    c.contribution += play.ownGain + play.enemyLoss;
+    c.effectValue += realizedEffect(play);
+    playedThisGame[play.player].push_back(play.card);
+}
+
+void CardStats::onGameEnd(std::uint64_t /*game*/, const Game& result) {
+    if (result.isGameOver()) {
+        for (int player = 0; player < 2; ++player) {
+            const bool won = result.getPlayer(player).getRoundsWon() >= 2;
+            for (std::uint32_t card : playedThisGame[player]) {
+                Counters& c = counters[std::min<std::size_t>(card, counters.size() - 1)];
+                ++c.decidedPlays;
+                if (won) ++c.wins;
+            }
+        }
+    }
+    playedThisGame[0].clear();
+    playedThisGame[1].clear();
+}
+
+void CardStats::merge(const CardStats& other) {
+    if (other.counters.size() > counters.size()) counters.resize(other.counters.size());
+    for (std::size_t i = 0; i < other.counters.size(); ++i) {
+        const Counters& from = other.counters[i];
+        Counters& to = counters[i];
+        if (from.plays) to.effect = from.effect;
+        to.plays += from.plays;
+        to.decidedPlays += from.decidedPlays;
+        to.wins += from.wins;
+        to.contribution += from.contribution;
+        to.effectValue += from.effectValue;
+    }
+}
+
+void CardStats::printReport(std::ostream& out, const CardCatalog& catalog, SortKey key) const {
+    std::vector<std::size_t> order(catalog.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        const double va = sortValue(counters[a], key);
+        const double vb = sortValue(counters[b], key);
+        if (va != vb) return va > vb;
+        if (counters[a].plays != counters[b].plays) return counters[a].plays > counters[b].plays;
+        return catalog.nameOf(static_cast<std::uint32_t>(a)) < catalog.nameOf(static_cast<std::uint32_t>(b));
+    });
+
+    out << std::left << std::setw(28) << "Card" << std::setw(28) << "Deploy effect"
+        << std::right << std::setw(10) << "Plays" << std::setw(9) << "Win %"
+        << std::setw(11) << "Avg lead" << std::setw(12) << "Avg effect" << "\n";
+    out << std::fixed << std::setprecision(2);
+    for (std::size_t id : order) {
+        const Counters& c = counters[id];
+        out << std::left << std::setw(28) << catalog.nameOf(static_cast<std::uint32_t>(id))
+            << std::setw(28) << (c.effect == DeployEffect::NONE ? "-" : CardUtils::deployEffectToString(c.effect))
+            << std::right << std::setw(10) << c.plays
+            << std::setw(9) << 100.0 * ratio(static_cast<double>(c.wins), c.decidedPlays)
+            << std::setw(11) << ratio(static_cast<double>(c.contribution), c.plays)
+            << std::setw(12) << ratio(static_cast<double>(c.effectValue), c.plays) << "\n";
+    }
+    out << std::defaultfloat;
+}
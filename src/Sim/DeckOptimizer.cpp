@@ -0,0 +1,312 @@
+#include "../include/Sim/DeckOptimizer.h"
+#include "../include/Core/Game.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    const char MAGIC[] = "GWDO";
+    constexpr int VERSION = 2;
+    constexpr std::uint64_t BATCH = 16;
+    // Each generation is dealt from its own range of game seeds.
+    constexpr std::uint64_t GENERATION_STRIDE = 1000003;
+
+    void writeCards(std::ostream& out, const DeckOptimizer::Candidate& candidate) {
+        out << candidate.fitness;
+        for (std::uint32_t id : candidate.cards) out << ' ' << id;
+        out << '\n';
+    }
+
+    DeckOptimizer::Candidate readCards(std::istream& line, std::size_t deckSize, std::size_t catalogSize) {
+        DeckOptimizer::Candidate candidate;
+        line >> candidate.fitness;
+        std::uint32_t id;
+        while (line >> id) {
+            if (id >= catalogSize) throw std::runtime_error("Checkpoint names a card outside the catalog");
+            candidate.cards.push_back(id);
+        }
+        std::sort(candidate.cards.begin(), candidate.cards.end());
+        if (candidate.cards.size() != deckSize ||
+            std::adjacent_find(candidate.cards.begin(), candidate.cards.end()) != candidate.cards.end()) {
+            throw std::runtime_error("Checkpoint holds an illegal deck");
+        }
+        return candidate;
+    }
+}
+
+DeckOptimizer::DeckOptimizer(const Simulator& simulator, OptimizerConfig config)
+    : simulator(simulator), config(std::move(config)), rng(this->config.seed) {
+    const auto& pool = simulator.getPool().getCards();
+    for (std::uint32_t id = 0; id < pool.size(); ++id) {
+        const Faction faction = pool[id]->getFaction();
+        if (this->config.faction == Faction::NEUTRAL || faction == this->config.faction ||
+            faction == Faction::NEUTRAL) {
+            allowed.push_back(id);
+        }
+    }
+    const std::size_t cards = simulator.getCatalog().size();
+    const std::size_t largest = std::min(Game::MAX_DECK_SIZE, allowed.size());
+    if (this->config.deckSize < Game::MIN_DECK_SIZE || this->config.deckSize > largest) {
+        throw std::invalid_argument("Deck size must be between " + std::to_string(Game::MIN_DECK_SIZE) +
+                                    " and " + std::to_string(largest) + " for this faction");
+    }
+    if (!this->config.reference.empty() &&
+        (this->config.reference.size() < Game::MIN_DECK_SIZE ||
+         this->config.reference.size() > Game::MAX_DECK_SIZE)) {
+        throw std::invalid_argument("Reference deck must hold between " + std::to_string(Game::MIN_DECK_SIZE) +
+                                    " and " + std::to_string(Game::MAX_DECK_SIZE) + " cards");
+    }
+    if (this->config.population < 2 || this->config.elite >= this->config.population) {
+        throw std::invalid_argument("Population must be at least 2 and larger than the elite");
+    }
+    if (this->config.gamesPerEval == 0 || this->config.tournament == 0) {
+        throw std::invalid_argument("Games per evaluation and tournament size must be positive");
+    }
+    for (std::uint32_t id : this->config.reference) {
+        if (id >= cards) throw std::invalid_argument("Reference deck names a card outside the catalog");
+    }
+}
+
+DeckOptimizer::Candidate DeckOptimizer::run(std::ostream& log) {
+    if (loadCheckpoint()) {
+        log << "resumed " << config.checkpoint << " at generation " << generation << "\n";
+    } else {
+        seedPopulation();
+    }
+
+    while (generation < config.generations) {
+        const auto started = std::chrono::steady_clock::now();
+        evaluate();
+        std::stable_sort(population.begin(), population.end(), [](const Candidate& a, const Candidate& b) {
+            return a.fitness > b.fitness;
+        });
+        if (population.front().fitness > best.fitness) best = population.front();
+
+        double total = 0;
+        for (const auto& candidate : population) total += candidate.fitness;
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        log << "generation " << generation + 1 << "/" << config.generations
+            << ": best " << 100.0 * population.front().fitness << "%, mean "
+            << 100.0 * total / population.size() << "% ("
+            << population.size() * config.gamesPerEval << " games, " << seconds << " s)\n";
+
+        breed();
+        ++generation;
+        if (!config.checkpoint.empty()) saveCheckpoint();
+    }
+    return best;
+}
+
+void DeckOptimizer::seedPopulation() {
+    std::vector<std::uint32_t> ids = allowed;
+    population.clear();
+    for (std::size_t i = 0; i < config.population; ++i) {
+        for (std::size_t j = 0; j < config.deckSize; ++j) {
+            std::uniform_int_distribution<std::size_t> pick(j, ids.size() - 1);
+            std::swap(ids[j], ids[pick(rng)]);
+        }
+        Candidate candidate;
+        candidate.cards.assign(ids.begin(), ids.begin() + config.deckSize);
+        std::sort(candidate.cards.begin(), candidate.cards.end());
+        population.push_back(std::move(candidate));
+    }
+}
+
+// The whole population is one pool of games, so the last few candidates
+// do not leave cores idle the way one run() per candidate would.
+void DeckOptimizer::evaluate() {
+    const std::uint64_t games = config.gamesPerEval;
+    const std::uint64_t jobs = games * population.size();
+
+    SimulationConfig deal;
+    deal.games = jobs;
+    deal.threads = config.threads;
+    deal.seed = config.seed + generation * GENERATION_STRIDE;
+    deal.swapSeats = true;
+    deal.decks[1] = config.reference;
+    deal.factions[0] = config.faction;
+    std::vector<SimulationConfig> matchups(population.size(), deal);
+    for (std::size_t i = 0; i < population.size(); ++i) {
+        matchups[i].decks[0] = population[i].cards;
+    }
+
+    const unsigned workers = simulator.workerCount(deal);
+    std::vector<std::vector<std::uint64_t>> wins(workers, std::vector<std::uint64_t>(population.size(), 0));
+    std::vector<std::exception_ptr> failures(workers);
+    std::atomic<std::uint64_t> nextJob{0};
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < workers; ++i) {
+        threads.emplace_back([&, i] {
+            try {
+                for (;;) {
+                    const std::uint64_t first = nextJob.fetch_add(BATCH, std::memory_order_relaxed);
+                    if (first >= jobs) break;
+                    const std::uint64_t last = std::min(first + BATCH, jobs);
+                    for (std::uint64_t job = first; job < last; ++job) {
+                        const std::size_t candidate = static_cast<std::size_t>(job / games);
+                        SimulationResult result;
+                        simulator.playGame(matchups[candidate], job % games, nullptr, result);
+                        wins[i][candidate] += result.wins[0];
+                    }
+                }
+            } catch (...) {
+                failures[i] = std::current_exception();
+                nextJob.store(jobs, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& failure : failures) {
+        if (failure) std::rethrow_exception(failure);
+    }
+
+    for (std::size_t c = 0; c < population.size(); ++c) {
+        std::uint64_t total = 0;
+        for (const auto& worker : wins) total += worker[c];
+        population[c].fitness = static_cast<double>(total) / games;
+    }
+}
+
+// Expects the population sorted best first. Elites are re-evaluated on the
+// next generation's deals, so a lucky batch does not keep a deck alive.
+void DeckOptimizer::breed() {
+    std::vector<Candidate> next;
+    next.reserve(config.population);
+    for (std::size_t i = 0; i < config.elite && i < population.size(); ++i) {
+        next.push_back(population[i]);
+        next.back().fitness = -1.0;
+    }
+    while (next.size() < config.population) {
+        const Candidate& mother = pickParent();
+        const Candidate& father = pickParent();
+        Candidate child = crossover(mother, father);
+        mutate(child);
+        next.push_back(std::move(child));
+    }
+    population = std::move(next);
+}
+
+const DeckOptimizer::Candidate& DeckOptimizer::pickParent() {
+    std::uniform_int_distribution<std::size_t> pick(0, population.size() - 1);
+    const Candidate* winner = &population[pick(rng)];
+    for (std::size_t i = 1; i < config.tournament; ++i) {
+        const Candidate& rival = population[pick(rng)];
+        if (rival.fitness > winner->fitness) winner = &rival;
+    }
+    return *winner;
+}
+
+// Cards both parents run are kept; the rest are drawn from either parent.
+DeckOptimizer::Candidate DeckOptimizer::crossover(const Candidate& a, const Candidate& b) {
+    Candidate child;
+    std::set_intersection(a.cards.begin(), a.cards.end(), b.cards.begin(), b.cards.end(),
+                          std::back_inserter(child.cards));
+    std::vector<std::uint32_t> either;
+    std::set_symmetric_difference(a.cards.begin(), a.cards.end(), b.cards.begin(), b.cards.end(),
+                                  std::back_inserter(either));
+    std::shuffle(either.begin(), either.end(), rng);
+    const std::size_t missing = config.deckSize - child.cards.size();
+    child.cards.insert(child.cards.end(), either.begin(), either.begin() + missing);
+    std::sort(child.cards.begin(), child.cards.end());
+    return child;
+}
+
+void DeckOptimizer::mutate(Candidate& child) {
+    if (config.deckSize >= allowed.size()) return;
+
+    std::vector<bool> inDeck(simulator.getCatalog().size(), false);
+    for (std::uint32_t id : child.cards) inDeck[id] = true;
+
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    std::uniform_int_distribution<std::size_t> pick(0, allowed.size() - 1);
+    for (auto& id : child.cards) {
+        if (chance(rng) >= config.mutationRate) continue;
+        std::uint32_t replacement;
+        do {
+            replacement = allowed[pick(rng)];
+        } while (inDeck[replacement]);
+        inDeck[id] = false;
+        inDeck[replacement] = true;
+        id = replacement;
+    }
+    std::sort(child.cards.begin(), child.cards.end());
+}
+
+bool DeckOptimizer::loadCheckpoint() {
+    if (config.checkpoint.empty()) return false;
+    std::ifstream file(config.checkpoint);
+    if (!file.is_open()) return false;
+
+    const std::size_t cards = simulator.getCatalog().size();
+    std::string magic;
+    int version = 0;
+    std::size_t catalogSize = 0;
+    std::size_t deckSize = 0;
+    std::size_t count = 0;
+    int faction = 0;
+    file >> magic >> version >> catalogSize >> deckSize >> faction >> generation >> count >> rng;
+    if (!file || magic != MAGIC || version != VERSION) {
+        throw std::runtime_error("Not a deck optimizer checkpoint: " + config.checkpoint);
+    }
+    if (catalogSize != cards || deckSize != config.deckSize || faction != static_cast<int>(config.faction)) {
+        throw std::runtime_error("Checkpoint was made with a different catalog, deck size or faction: " +
+                                 config.checkpoint);
+    }
+
+    std::string line;
+    std::getline(file, line);
+    population.clear();
+    for (std::size_t i = 0; i <= count; ++i) {
+        if (!std::getline(file, line)) {
+            throw std::runtime_error("Checkpoint is truncated: " + config.checkpoint);
+        }
+        std::istringstream fields(line);
+        Candidate candidate = readCards(fields, deckSize, cards);
+        if (i == 0) {
+            best = std::move(candidate);
+        } else {
+            candidate.fitness = -1.0;
+            population.push_back(std::move(candidate));
+        }
+    }
+    if (population.size() < 2) {
+        throw std::runtime_error("Checkpoint population is too small: " + config.checkpoint);
+    }
+    return true;
+}
+
+// Written beside the old file and renamed over it, so a crash mid-write
+// leaves the previous generation in place.
+void DeckOptimizer::saveCheckpoint() const {
+    const std::string temporary = config.checkpoint + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to open file: " + temporary);
+        }
+        file.precision(17);
+        file << MAGIC << ' ' << VERSION << ' ' << simulator.getCatalog().size() << ' ' << config.deckSize
+             << ' ' << static_cast<int>(config.faction) << ' ' << generation << ' ' << population.size() << '\n' << rng << '\n';
+        writeCards(file, best);
+        for (const auto& candidate : population) {
+            writeCards(file, candidate);
+        }
+        file.close();
+        if (file.fail()) {
+            throw std::runtime_error("Failed to write checkpoint: " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), config.checkpoint.c_str()) != 0) {
+        throw std::runtime_error("Failed to replace checkpoint: " + config.checkpoint);
+    }
+}
@@ -0,0 +1,91 @@
+#include "../include/Sim/HandSampler.h"
+#include "../include/Core/Game.h"
+#include <algorithm>
+#include <stdexcept>
+
+HandSampler::HandSampler(const CardCatalog& catalog, std::uint32_t seed)
+    : catalog(catalog), rng(seed),
+      deckCounts(catalog.size(), 0), revealedCounts(catalog.size(), 0), visibleCounts(catalog.size(), 0) {}
+
+void HandSampler::reset(const std::vector<std::uint32_t>& deckList) {
+    std::fill(deckCounts.begin(), deckCounts.end(), 0);
+    std::fill(revealedCounts.begin(), revealedCounts.end(), 0);
+    std::fill(visibleCounts.begin(), visibleCounts.end(), 0);
+    for (std::uint32_t card : deckList) {
+        if (card >= deckCounts.size()) {
+            throw std::out_of_range("Deck list names a card outside the catalog");
+        }
+        ++deckCounts[card];
+    }
+    unseen.clear();
+    unseen.reserve(deckList.size());
+    stale = true;
+}
+
+void HandSampler::reveal(std::uint32_t card) {
+    if (card < revealedCounts.size() && revealedCounts[card] < deckCounts[card]) {
+        ++revealedCounts[card];
+        stale = true;
+    }
+}
+
+void HandSampler::observe(const Game& game, int opponent) {
+    std::fill(visibleCounts.begin(), visibleCounts.end(), 0);
+    const Board& board = game.getBoard();
+    auto count = [this](const std::vector<std::unique_ptr<Card>>& cards) {
+        for (const auto& card : cards) {
+            const std::uint32_t id = catalog.idOf(card->getName());
+            if (id < visibleCounts.size()) ++visibleCounts[id];
+        }
+    };
+    for (auto zone : {CombatZone::CLOSE, CombatZone::RANGED, CombatZone::SIEGE}) {
+        count(board.getPlayerZone(opponent, zone));
+    }
+    count(board.getPlayerGraveyard(opponent));
+
+    const Player& player = game.getPlayer(opponent);
+    setHiddenSizes(player.getHandSize(), player.getDeck() ? player.getDeck()->size() : 0);
+    stale = true;
+}
+
+void HandSampler::setHiddenSizes(std::size_t hand, std::size_t deck) {
+    handSize = hand;
+    deckSize = deck;
+}
+
+// Fits in the capacity reset() reserved, since it never holds more cards
+// than the deck list.
+void HandSampler::rebuild() {
+    unseen.clear();
+    for (std::uint32_t id = 0; id < deckCounts.size(); ++id) {
+        const int seen = std::max(revealedCounts[id], visibleCounts[id]);
+        for (int n = deckCounts[id] - seen; n > 0; --n) {
+            unseen.push_back(id);
+        }
+    }
+    stale = false;
+}
+
+std::size_t HandSampler::unseenCount() {
+    if (stale) rebuild();
+    return unseen.size();
+}
+
+// Any order of the buffer is as good a start as any other, so each sample
+// shuffles on from where the last one left off.
+Determinization HandSampler::sample(std::size_t deckDepth) {
+    if (stale) rebuild();
+
+    const std::size_t total = unseen.size();
+    const std::size_t hand = std::min(handSize, total);
+    const std::size_t deck = std::min({deckSize, deckDepth, total - hand});
+    const std::size_t picks = std::min(hand + deck, total > 0 ? total - 1 : 0);
+    for (std::size_t i = 0; i < picks; ++i) {
+        // Multiply-shift instead of a modulo; the bias is negligible for
+        // the few dozen cards a deck holds.
+        const std::size_t range = total - i;
+        const std::size_t j = i + static_cast<std::size_t>((static_cast<std::uint64_t>(rng()) * range) >> 32);
+        std::swap(unseen[i], unseen[j]);
+    }
+    return {unseen.data(), hand, unseen.data() + hand, deck};
+}
@@ -0,0 +1,48 @@
+#include "../include/Sim/DeckOptimizer.h"
+#include "../include/Utils/CardUtils.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// gwent_deckopt [generations] [population] [games per deck] [deck size] [threads] [deck.json] [checkpoint|-] [faction]
+int main(int argc, char* argv[]) {
+    OptimizerConfig config;
+    config.generations = argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) : 20;
+    config.population = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 32;
+    config.gamesPerEval = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 64;
+    config.deckSize = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 25;
+    config.threads = argc > 5 ? static_cast<unsigned>(std::atoi(argv[5])) : 0;
+    const std::string deckFile = argc > 6 ? argv[6] : "../assets/cards.json";
+    config.checkpoint = argc > 7 ? argv[7] : "deckopt.ckpt";
+    if (config.checkpoint == "-") config.checkpoint.clear();
+    const std::string factionName = argc > 8 ? argv[8] : "NEUTRAL";
+    config.faction = CardUtils::enumFromString<Faction>(factionName);
+    if (config.faction == Faction::NEUTRAL && factionName != "NEUTRAL") {
+        std::cerr << "Unknown faction: " << factionName << " (NORTH, SCOIATAEL, NILFGARD, MONSTERS, NEUTRAL)\n";
+        return 1;
+    }
+
+    try {
+        Simulator simulator(deckFile);
+        DeckOptimizer optimizer(simulator, config);
+        const DeckOptimizer::Candidate best = optimizer.run(std::cerr);
+
+        std::vector<std::string> names;
+        for (std::uint32_t id : best.cards) {
+            names.push_back(simulator.getCatalog().nameOf(id));
+        }
+        std::sort(names.begin(), names.end());
+
+        std::cout << "Best deck, " << 100.0 * best.fitness << "% against the reference over "
+                  << config.gamesPerEval << " games:\n";
+        for (const auto& name : names) {
+            std::cout << "  " << name << "\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
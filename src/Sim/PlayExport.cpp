@@ -0,0 +1,250 @@
+#include "../include/Sim/PlayExport.h"
+#include "../include/Utils/Varint.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+using namespace PlayExport;
+
+namespace {
+    const char MAGIC[4] = {'G', 'W', 'P', 'X'};
+    constexpr std::uint8_t VERSION = 1;
+    constexpr std::uint64_t MAX_GROUP_ROWS = 1u << 24;
+
+    enum Encoding : std::uint8_t { PLAIN = 0, RUNS = 1 };
+
+    std::uint64_t zigzag(std::int64_t value) {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    std::int64_t unzigzag(std::uint64_t value) {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    void encodePlain(const std::vector<std::int64_t>& values, std::string& out) {
+        for (std::int64_t value : values) {
+            Varint::putVarint(out, zigzag(value));
+        }
+    }
+
+    void encodeRuns(const std::vector<std::int64_t>& values, std::string& out) {
+        std::int64_t previous = 0;
+        for (std::size_t i = 0; i < values.size();) {
+            std::size_t run = 1;
+            while (i + run < values.size() && values[i + run] == values[i]) ++run;
+            Varint::putVarint(out, zigzag(values[i] - previous));
+            Varint::putVarint(out, run);
+            previous = values[i];
+            i += run;
+        }
+    }
+
+    bool decode(std::uint8_t encoding, std::string_view data, std::size_t rows,
+                std::vector<std::int64_t>& out) {
+        out.clear();
+        out.reserve(rows);
+        Varint::Reader in(data);
+        if (encoding == PLAIN) {
+            for (std::size_t i = 0; i < rows; ++i) {
+                out.push_back(unzigzag(in.varint()));
+            }
+        } else if (encoding == RUNS) {
+            std::int64_t value = 0;
+            while (out.size() < rows && in.ok() && !in.atEnd()) {
+                value += unzigzag(in.varint());
+                const std::uint64_t run = in.varint();
+                if (run == 0 || run > rows - out.size()) return false;
+                out.insert(out.end(), static_cast<std::size_t>(run), value);
+            }
+        } else {
+            return false;
+        }
+        return in.ok() && in.atEnd() && out.size() == rows;
+    }
+
+    std::uint64_t readVarint(std::istream& in) {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            const int b = in.get();
+            if (b == std::char_traits<char>::eof()) break;
+            value |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+            if (!(b & 0x80)) return value;
+        }
+        throw std::runtime_error("Play export is truncated or corrupt");
+    }
+}
+
+PlayExportWriter::PlayExportWriter(const std::string& path, const CardCatalog& catalog)
+    : file(path, std::ios::binary | std::ios::trunc) {
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + path);
+    }
+
+    std::string header(MAGIC, sizeof(MAGIC));
+    header.push_back(static_cast<char>(VERSION));
+    header.push_back(static_cast<char>(COLUMN_COUNT));
+    Varint::putVarint(header, catalog.size());
+    for (std::uint32_t id = 0; id < catalog.size(); ++id) {
+        const std::string& name = catalog.nameOf(id);
+        Varint::putVarint(header, name.size());
+        header += name;
+    }
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    byteCount = header.size();
+}
+
+PlayExportWriter::~PlayExportWriter() {
+    try {
+        finish();
+    } catch (const std::exception& e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+    }
+}
+
+void PlayExportWriter::writeGroup(const std::string& group, std::size_t rows) {
+    std::lock_guard<std::mutex> lock(mutex);
+    file.write(group.data(), static_cast<std::streamsize>(group.size()));
+    rowCount += rows;
+    byteCount += group.size();
+}
+
+void PlayExportWriter::finish() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (finished) return;
+    finished = true;
+
+    file.put(0);
+    ++byteCount;
+    file.close();
+    if (file.fail()) {
+        throw std::runtime_error("Failed to write play export");
+    }
+}
+
+PlayRecorder::PlayRecorder(PlayExportWriter& writer) : writer(writer) {
+    for (auto& column : columns) {
+        column.reserve(ROW_GROUP);
+    }
+}
+
+void PlayRecorder::onPlay(const PlayEvent& play) {
+    currentRound.push_back(play);
+}
+
+// A worker plays one game at a time, so everything buffered belongs to the
+// round that just ended.
+void PlayRecorder::onRoundEnd(std::uint64_t /*game*/, int /*round*/, const std::array<int, 2>& scores) {
+    for (const auto& play : currentRound) {
+        const int own = scores[play.player];
+        const int other = scores[1 - play.player];
+        const Outcome outcome = own > other ? Outcome::WIN : own < other ? Outcome::LOSS : Outcome::DRAW;
+
+        columns[static_cast<std::size_t>(Column::GAME)].push_back(static_cast<std::int64_t>(play.game));
+        columns[static_cast<std::size_t>(Column::ROUND)].push_back(play.round);
+        columns[static_cast<std::size_t>(Column::PLAYER)].push_back(play.player);
+        columns[static_cast<std::size_t>(Column::CARD)].push_back(play.card);
+        columns[static_cast<std::size_t>(Column::ZONE)].push_back(static_cast<std::int64_t>(play.zone));
+        columns[static_cast<std::size_t>(Column::POWER)].push_back(play.power);
+        columns[static_cast<std::size_t>(Column::ROW_DELTA)].push_back(play.rowDelta);
+        columns[static_cast<std::size_t>(Column::OUTCOME)].push_back(static_cast<std::int64_t>(outcome));
+        ++rows;
+    }
+    currentRound.clear();
+
+    if (rows >= ROW_GROUP) flush();
+}
+
+// Plays from a round that never finished have no outcome and are dropped.
+void PlayRecorder::onGameEnd(std::uint64_t /*game*/, const Game& /*result*/) {
+    currentRound.clear();
+}
+
+void PlayRecorder::flush() {
+    if (rows == 0) return;
+
+    encoded.clear();
+    Varint::putVarint(encoded, rows);
+    std::string plain;
+    std::string runs;
+    for (auto& column : columns) {
+        plain.clear();
+        runs.clear();
+        encodePlain(column, plain);
+        encodeRuns(column, runs);
+        const bool useRuns = runs.size() < plain.size();
+        const std::string& chosen = useRuns ? runs : plain;
+
+        encoded.push_back(static_cast<char>(useRuns ? RUNS : PLAIN));
+        Varint::putVarint(encoded, chosen.size());
+        encoded += chosen;
+        column.clear();
+    }
+
+    writer.writeGroup(encoded, rows);
+    rows = 0;
+}
+
+PlayExportReader::PlayExportReader(const std::string& path) : file(path, std::ios::binary) {
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + path);
+    }
+
+    char header[sizeof(MAGIC) + 2];
+    if (!file.read(header, sizeof(header)) ||
+        !std::equal(MAGIC, MAGIC + sizeof(MAGIC), header) ||
+        static_cast<std::uint8_t>(header[4]) != VERSION ||
+        static_cast<std::uint8_t>(header[5]) != COLUMN_COUNT) {
+        throw std::runtime_error("Not a play export: " + path);
+    }
+
+    const std::uint64_t count = readVarint(file);
+    for (std::uint64_t i = 0; i < count; ++i) {
+        std::string name(static_cast<std::size_t>(readVarint(file)), '\0');
+        if (!file.read(&name[0], static_cast<std::streamsize>(name.size()))) {
+            throw std::runtime_error("Play export is truncated or corrupt");
+        }
+        cardNames.push_back(std::move(name));
+    }
+    nextGroupOffset = file.tellg();
+}
+
+bool PlayExportReader::nextGroup() {
+    file.clear();
+    file.seekg(nextGroupOffset);
+    const std::uint64_t count = readVarint(file);
+    if (count > MAX_GROUP_ROWS) {
+        throw std::runtime_error("Play export is truncated or corrupt");
+    }
+    rows = static_cast<std::size_t>(count);
+    if (rows == 0) return false;
+
+    for (auto& chunk : chunks) {
+        const int encoding = file.get();
+        chunk.encoding = static_cast<std::uint8_t>(encoding);
+        chunk.size = static_cast<std::size_t>(readVarint(file));
+        chunk.offset = file.tellg();
+        chunk.decoded = false;
+        file.seekg(static_cast<std::streamoff>(chunk.size), std::ios::cur);
+        if (encoding == std::char_traits<char>::eof() || !file) {
+            throw std::runtime_error("Play export is truncated or corrupt");
+        }
+    }
+    nextGroupOffset = file.tellg();
+    return true;
+}
+
+const std::vector<std::int64_t>& PlayExportReader::column(Column column) {
+    const std::size_t index = static_cast<std::size_t>(column);
+    Chunk& chunk = chunks.at(index);
+    if (!chunk.decoded) {
+        buffer.resize(chunk.size);
+        file.clear();
+        file.seekg(chunk.offset);
+        if (!file.read(&buffer[0], static_cast<std::streamsize>(chunk.size)) ||
+            !decode(chunk.encoding, buffer, rows, values[index])) {
+            throw std::runtime_error("Play export is truncated or corrupt");
+        }
+        chunk.decoded = true;
+    }
+    return values[index];
+}
@@ -0,0 +1,217 @@
+#include "../include/Sim/Simulator.h"
+#include "../include/Core/Game.h"
+#include "../include/Card/UnitCard.h"
+#include "../include/Core/DeckBuilder.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Games are handed out in small batches so workers rarely touch the counter.
+    constexpr std::uint64_t BATCH = 16;
+
+    int rowLead(const Board& board, int player, CombatZone zone) {
+        if (zone == CombatZone::ANY) {
+            int lead = 0;
+            for (auto row : {CombatZone::CLOSE, CombatZone::RANGED, CombatZone::SIEGE}) {
+                lead += board.getPlayerPower(player, row) - board.getPlayerPower(1 - player, row);
+            }
+            return lead;
+        }
+        return board.getPlayerPower(player, zone) - board.getPlayerPower(1 - player, zone);
+    }
+
+    struct Tally {
+        int own = 0;
+        int enemy = 0;
+        int units = 0;
+        int hand = 0;
+    };
+
+    Tally tally(const Game& game, int player) {
+        const Board& board = game.getBoard();
+        Tally result;
+        for (auto row : {CombatZone::CLOSE, CombatZone::RANGED, CombatZone::SIEGE}) {
+            result.own += board.getPlayerPower(player, row);
+            result.enemy += board.getPlayerPower(1 - player, row);
+        }
+        result.units = static_cast<int>(board.getPlayerUnits(player).size());
+        result.hand = static_cast<int>(game.getPlayer(player).getHandSize());
+        return result;
+    }
+
+    // Picked decks go through the same legality checks as a player's deck.
+    std::unique_ptr<Deck> buildDeck(const Deck& pool, const std::vector<std::uint32_t>& picks, Faction faction) {
+        if (picks.empty()) {
+            return Game::buildDeck(pool, faction);
+        }
+        auto deck = DeckBuilder()
+                        .addCopies(pool, picks)
+                        .forFaction(faction)
+                        .minSize(Game::MIN_DECK_SIZE)
+                        .maxSize(Game::MAX_DECK_SIZE)
+                        .build();
+        if (deck->size() != picks.size()) {
+            throw std::invalid_argument("Deck holds cards outside its faction");
+        }
+        return deck;
+    }
+}
+
+void Simulator::playGame(const SimulationConfig& config, std::uint64_t gameIndex,
+                         SimulationObserver* observer, SimulationResult& result) const {
+    Game game("Bot A", "Bot B");
+    // Nobody reads the narration of thousands of bot games.
+    game.setOutput(nullptr);
+    const bool swapped = config.swapSeats && gameIndex % 2 == 1;
+    auto first = buildDeck(pool, config.decks[0], config.factions[0]);
+    auto second = buildDeck(pool, config.decks[1], config.factions[1]);
+    if (swapped) std::swap(first, second);
+    game.setPlayerDecks(std::move(first), std::move(second));
+    game.setSeed(static_cast<std::uint32_t>(config.seed + gameIndex));
+    game.startGame();
+
+    std::mt19937 rng(static_cast<std::uint32_t>(config.seed + gameIndex));
+    std::size_t roundsSeen = 0;
+
+    for (int turn = 0; turn < config.maxTurns && !game.isGameOver(); ++turn) {
+        const int player = game.getCurrentPlayerIndex();
+        const auto& hand = game.getPlayer(player).getHand();
+        const bool play = !game.hasPassed(player) && !hand.empty() && rng() % 10 < 8;
+
+        try {
+            if (play) {
+                const int index = static_cast<int>(rng() % hand.size());
+                const Card& card = *hand[index];
+                const auto* unit = dynamic_cast<const UnitCard*>(&card);
+                PlayEvent event{};
+                event.game = gameIndex;
+                event.round = game.getCurrentRound();
+                event.player = player;
+                event.card = catalog.idOf(card.getName());
+                event.zone = card.getZone();
+                event.effect = unit ? unit->getDeployEffect() : DeployEffect::NONE;
+                event.power = card.getPower();
+                const int leadBefore = observer ? rowLead(game.getBoard(), player, event.zone) : 0;
+                const Tally before = observer ? tally(game, player) : Tally();
+
+                game.playCard(player, index);
+                game.update(0.f);
+
+                if (observer) {
+                    const Tally after = tally(game, player);
+                    event.rowDelta = rowLead(game.getBoard(), player, event.zone) - leadBefore;
+                    event.ownGain = after.own - before.own;
+                    event.enemyLoss = before.enemy - after.enemy;
+                    event.unitsAdded = after.units - before.units;
+                    event.cardsDrawn = after.hand - (before.hand - 1);
+                    observer->onPlay(event);
+                }
+            } else {
+                game.pass(player);
+                game.update(0.f);
+            }
+        } catch (const std::exception&) {
+            // A rule the engine refuses ends the turn as a pass.
+            if (game.isGameOver() || game.getCurrentPlayerIndex() != player) continue;
+            game.pass(player);
+            game.update(0.f);
+        }
+
+        const auto& scores = game.getRoundScores();
+        for (; roundsSeen < scores.size(); ++roundsSeen) {
+            if (observer) observer->onRoundEnd(gameIndex, static_cast<int>(roundsSeen) + 1, scores[roundsSeen]);
+        }
+    }
+
+    ++result.games;
+    if (game.isGameOver()) {
+        ++result.finished;
+        if (game.getPlayer(0).getRoundsWon() >= 2) ++result.wins[swapped ? 1 : 0];
+        if (game.getPlayer(1).getRoundsWon() >= 2) ++result.wins[swapped ? 0 : 1];
+    }
+    if (observer) observer->onGameEnd(gameIndex, game);
+}
+
+Simulator::Simulator(const std::string& deckFile) {
+    std::ifstream file(deckFile);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + deckFile);
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    const std::string deckJson = contents.str();
+    catalog.load(deckJson);
+    std::istringstream cards(deckJson);
+    pool.loadFromJson(cards);
+    if (pool.size() != catalog.size()) {
+        throw std::runtime_error("Deck file has duplicate or unreadable cards: " + deckFile);
+    }
+}
+
+unsigned Simulator::workerCount(const SimulationConfig& config) const {
+    unsigned workers = config.threads;
+    if (workers == 0) {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        workers = hardware ? hardware : 4;
+    }
+    return static_cast<unsigned>(std::max<std::uint64_t>(1, std::min<std::uint64_t>(workers, config.games)));
+}
+
+SimulationResult Simulator::run(const SimulationConfig& config,
+                                const std::function<SimulationObserver*(unsigned worker)>& observerFor) {
+    const unsigned workers = workerCount(config);
+    std::vector<SimulationObserver*> observers(workers, nullptr);
+    if (observerFor) {
+        for (unsigned i = 0; i < workers; ++i) {
+            observers[i] = observerFor(i);
+        }
+    }
+
+    std::atomic<std::uint64_t> nextGame{0};
+    std::vector<SimulationResult> results(workers);
+    std::vector<std::exception_ptr> failures(workers);
+    std::vector<std::thread> threads;
+    const auto started = std::chrono::steady_clock::now();
+
+    for (unsigned i = 0; i < workers; ++i) {
+        threads.emplace_back([&, i] {
+            try {
+                for (;;) {
+                    const std::uint64_t first = nextGame.fetch_add(BATCH, std::memory_order_relaxed);
+                    if (first >= config.games) break;
+                    const std::uint64_t last = std::min(first + BATCH, config.games);
+                    for (std::uint64_t game = first; game < last; ++game) {
+                        playGame(config, game, observers[i], results[i]);
+                    }
+                }
+            } catch (...) {
+                failures[i] = std::current_exception();
+                nextGame.store(config.games, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& failure : failures) {
+        if (failure) std::rethrow_exception(failure);
+    }
+
+    SimulationResult total;
+    for (const auto& result : results) {
+        total.games += result.games;
+        total.finished += result.finished;
+        total.wins[0] += result.wins[0];
+        total.wins[1] += result.wins[1];
+    }
+    total.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return total;
+}
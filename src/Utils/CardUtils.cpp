@@ -1,62 +1,101 @@
 #include "../include/Utils/CardUtils.h"
 #include "../include/Utils/enums.h"
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
 
-std::string CardUtils::weatherEffectDescription(WeatherType type) {
-    switch(type) {
-        case WeatherType::BITING_FROST: return "Freezing cold reduces Close combat units to 1 power";
-        case WeatherType::IMPENETRABLE_FOG: return "Thick fog reduces Ranged combat units to 1 power";
-        case WeatherType::TORRENTIAL_RAIN: return "Heavy rain reduces Siege combat units to 1 power";
-        case WeatherType::CLEAR_WEATHER: return "Clears all weather types from all zones";
-        default: return "Unknown weather effect";
+namespace {
+    constexpr std::string_view weatherFormats[] = {
+        "Freezing cold reduces Close combat units to 1 power",
+        "Thick fog reduces Ranged combat units to 1 power",
+        "Heavy rain reduces Siege combat units to 1 power",
+        "Clears all weather types from all zones",
+        "Unknown weather effect"
+    };
+
+    constexpr std::string_view deployEffectFormats[] = {
+        "",
+        "Deal {} damage to a random enemy.",
+        "Boost adjacent units by {}.",
+        "Draw {} card(s).",
+        "Destroy weakest enemy unit.",
+        "",
+        "",
+        "Revive last unit from graveyard.",
+        "Boost all lowest-power units by {}."
+    };
+
+    constexpr std::string_view heroAbilityFormats[] = {
+        "Double the power of an entire row.",
+        "Destroy strongest enemy unit.",
+        "Return a unit to your hand.",
+        "Boost strongest unit by {}.",
+        "Gain +{} per lost round."
+    };
+
+    constexpr std::string_view abilityEffectFormats[] = {
+        "Damage all units in row by {}.",
+        "Clear weather and boost row by {}.",
+        "Summon Foglet if Fog is active.",
+        "Boost row units by {}.",
+        "Poison strongest enemy ({} damage)."
+    };
+
+    static_assert(std::size(weatherFormats) == EnumTraits<WeatherType>::table.size());
+    static_assert(std::size(deployEffectFormats) == EnumTraits<DeployEffect>::table.size());
+    static_assert(std::size(heroAbilityFormats) == EnumTraits<HeroAbility>::table.size());
+    static_assert(std::size(abilityEffectFormats) == EnumTraits<AbilityEffect>::table.size());
+
+    std::string formatDescription(std::string_view format, int value) {
+        std::string result;
+        auto placeholder = format.find("{}");
+        if (placeholder == std::string_view::npos) {
+            result.assign(format);
+            return result;
+        }
+        result.reserve(format.size() + 10);
+        result.append(format.substr(0, placeholder));
+        result.append(std::to_string(value));
+        result.append(format.substr(placeholder + 2));
+        return result;
     }
-}
 
-std::string CardUtils::getDeployEffectDescription(DeployEffect effect, int value) {
-    switch(effect) {
-        case DeployEffect::DAMAGE_RANDOM_ENEMY: 
-            return "Deal " + std::to_string(value) + " damage to a random enemy.";
-        case DeployEffect::BOOST_ADJACENT: 
-            return "Boost adjacent units by " + std::to_string(value) + ".";
-        case DeployEffect::DRAW_CARD: 
-            return "Draw " + std::to_string(value) + " card(s).";
-        case DeployEffect::DESTROY_WEAKEST: 
-            return "Destroy weakest enemy unit.";
-        case DeployEffect::MORALE_BOOST: 
-            return "Boost all lowest-power units by " + std::to_string(value) + ".";
-        case DeployEffect::MEDIC: 
-            return "Revive last unit from graveyard.";
-        default: return "";
+    // Descriptions only depend on (enum value, effect value), so each pair is
+    // formatted once and every later lookup returns the same string.
+    template<typename EnumType, std::size_t N>
+    const std::string& describe(const std::string_view (&formats)[N], EnumType type, int value) {
+        static std::unordered_map<std::uint64_t, std::string> cache;
+        static const std::string empty;
+
+        auto index = static_cast<std::size_t>(type);
+        if (index >= N) return empty;
+
+        std::string_view format = formats[index];
+        if (format.find("{}") == std::string_view::npos) value = 0;
+
+        std::uint64_t key = (static_cast<std::uint64_t>(index) << 32) |
+                            static_cast<std::uint32_t>(value);
+        auto it = cache.find(key);
+        if (it == cache.end()) {
+            it = cache.emplace(key, formatDescription(format, value)).first;
+        }
+        return it->second;
     }
 }
 
-std::string CardUtils::getHeroAbilityDescription(HeroAbility ability, int value) {
-    switch(ability) {
-        case HeroAbility::COMMANDERS_HORN: 
-            return "Double the power of an entire row.";
-        case HeroAbility::SCORCH: 
-            return "Destroy strongest enemy unit.";
-        case HeroAbility::DECOY: 
-            return "Return a unit to your hand.";
-        case HeroAbility::ALCHEMY: 
-            return "Boost strongest unit by " + std::to_string(value) + ".";
-        case HeroAbility::REVENGE: 
-            return "Gain +" + std::to_string(value) + " per lost round.";
-        default: return "";
-    }
+const std::string& CardUtils::weatherEffectDescription(WeatherType type) {
+    return describe(weatherFormats, type, 0);
 }
 
-std::string CardUtils::getAbilityEffectDescription(AbilityEffect effect, int value) {
-    switch(effect) {
-        case AbilityEffect::DAMAGE_ROW: 
-            return "Damage all units in row by " + std::to_string(value)+ ".";
-        case AbilityEffect::CLEAR_SKIES: 
-            return "Clear weather and boost row by " + std::to_string(value)+ ".";
-        case AbilityEffect::FOGLET_SPAWN: 
-            return "Summon Foglet if Fog is active.";
-        case AbilityEffect::COMMANDO_TRAINING: 
-            return "Boost row units by " + std::to_string(value) + ".";
-        case AbilityEffect::VENOM_EXTRACT: 
-            return "Poison strongest enemy (" + std::to_string(value) + " damage).";
-        default: return "";
-    }
+const std::string& CardUtils::getDeployEffectDescription(DeployEffect effect, int value) {
+    return describe(deployEffectFormats, effect, value);
+}
+
+const std::string& CardUtils::getHeroAbilityDescription(HeroAbility ability, int value) {
+    return describe(heroAbilityFormats, ability, value);
+}
+
+const std::string& CardUtils::getAbilityEffectDescription(AbilityEffect effect, int value) {
+    return describe(abilityEffectFormats, effect, value);
 }
@@ -0,0 +1,83 @@
+#include "../include/Utils/Profiler.h"
+#include <fstream>
+#include <iostream>
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler() : origin(std::chrono::steady_clock::now()) {
+    for (auto& frame : frames) {
+        frame.events.reserve(MAX_EVENTS_PER_FRAME);
+    }
+}
+
+std::int64_t Profiler::now() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - origin).count();
+}
+
+void Profiler::beginFrame() {
+    endFrame();
+
+    frames[current].startUs = now();
+    frames[current].durationUs = 0;
+    frames[current].events.clear();
+    inFrame = true;
+}
+
+// Closing frames explicitly keeps idle time spent waiting for input out of
+// the recorded frame durations.
+void Profiler::endFrame() {
+    if (!inFrame) return;
+
+    frames[current].durationUs = now() - frames[current].startUs;
+    current = (current + 1) % HISTORY;
+    if (completed < HISTORY - 1) ++completed;
+    inFrame = false;
+}
+
+void Profiler::record(const char* name, std::int64_t startUs, std::int64_t durationUs) {
+    auto& events = frames[current].events;
+    if (events.size() < MAX_EVENTS_PER_FRAME) {
+        events.push_back({name, startUs, durationUs});
+    }
+}
+
+std::size_t Profiler::getFrameCount() const {
+    return completed;
+}
+
+const Profiler::Frame& Profiler::getFrame(std::size_t age) const {
+    return frames[(current + HISTORY - 1 - age % HISTORY) % HISTORY];
+}
+
+// Writes the recorded frames in the Chrome trace event format
+// (open with chrome://tracing or ui.perfetto.dev).
+bool Profiler::dumpChromeTrace(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open trace file: " << path << "\n";
+        return false;
+    }
+
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+    auto writeEvent = [&](const char* name, std::int64_t start, std::int64_t duration) {
+        file << (first ? "" : ",\n")
+             << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+             << ",\"ts\":" << start << ",\"dur\":" << duration << "}";
+        first = false;
+    };
+
+    for (std::size_t age = completed; age-- > 0;) {
+        const Frame& frame = getFrame(age);
+        writeEvent("frame", frame.startUs, frame.durationUs);
+        for (const auto& event : frame.events) {
+            writeEvent(event.name, event.startUs, event.durationUs);
+        }
+    }
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,146 @@
+#include "../include/Sim/HandSampler.h"
+#include "../include/Core/Game.h"
+#include "TestHarness.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// gwent_sampler_test [cards.json]
+//
+// Plays random games and, after every move, checks that the opponent's real
+// hand and deck could have been sampled: every hidden card is in the unseen
+// pool and the sampled sizes match the game's. Then times sample().
+namespace {
+    using TestHarness::check;
+
+    // Every card counted in part must also be in whole, as often.
+    bool contains(const std::vector<int>& whole, const std::vector<int>& part) {
+        for (std::size_t id = 0; id < part.size(); ++id) {
+            if (part[id] > whole[id]) return false;
+        }
+        return true;
+    }
+
+    void checkSampler(HandSampler& sampler, const Game& game, int opponent, const CardCatalog& catalog,
+                      const std::string& where) {
+        const Player& player = game.getPlayer(opponent);
+        const Deck& deck = *player.getDeck();
+
+        std::vector<int> hidden(catalog.size(), 0);
+        for (const auto& card : player.getHand()) ++hidden[catalog.idOf(card->getName())];
+        for (const auto& card : deck.getCards()) ++hidden[catalog.idOf(card->getName())];
+
+        // A deck as large as the pool lays out the whole pool.
+        sampler.observe(game, opponent);
+        const std::size_t unseen = sampler.unseenCount();
+        sampler.setHiddenSizes(0, unseen);
+        const Determinization all = sampler.sample();
+        std::vector<int> pool(catalog.size(), 0);
+        for (std::size_t i = 0; i < all.deckSize; ++i) ++pool[all.deck[i]];
+        check(all.deckSize == unseen, where + ": pool has " + std::to_string(unseen) + " cards");
+        check(contains(pool, hidden), where + ": a hidden card is missing from the unseen pool");
+        // No rule takes a card out of the game, so nothing else is left over.
+        check(unseen == player.getHandSize() + deck.size(), where + ": pool holds cards that are not hidden");
+
+        sampler.observe(game, opponent);
+        const Determinization guess = sampler.sample();
+        check(guess.handSize == player.getHandSize(), where + ": sampled hand size");
+        check(guess.deckSize == deck.size(), where + ": sampled deck size");
+        std::vector<int> sampled(catalog.size(), 0);
+        for (std::size_t i = 0; i < guess.handSize; ++i) ++sampled[guess.hand[i]];
+        for (std::size_t i = 0; i < guess.deckSize; ++i) ++sampled[guess.deck[i]];
+        check(contains(pool, sampled), where + ": sampled a card that is not in the pool");
+    }
+
+    // Plays up to turns moves of a random game, checking the sampler for
+    // seat 1 after every one, and leaves the sampler at the last of them.
+    void playGame(const std::string& cards, const CardCatalog& catalog, Faction first, Faction second,
+                  std::uint32_t seed, int turns, HandSampler& sampler) {
+        Game game("Alice", "Bob");
+        game.setOutput(nullptr);
+        std::istringstream deck(cards);
+        game.loadDeck(deck, first, second);
+        game.setSeed(seed);
+
+        const int opponent = 1;
+        std::vector<std::uint32_t> deckList;
+        for (const auto& card : game.getPlayer(opponent).getDeck()->getCards()) {
+            deckList.push_back(catalog.idOf(card->getName()));
+        }
+        game.startGame();
+        sampler.reset(deckList);
+
+        std::mt19937 rng(seed);
+        const std::string name = "game " + std::to_string(seed);
+        for (int turn = 0; turn < turns && !game.isGameOver(); ++turn) {
+            const int player = game.getCurrentPlayerIndex();
+            const auto& hand = game.getPlayer(player).getHand();
+            try {
+                if (!hand.empty() && rng() % 10 < 8) {
+                    const int index = static_cast<int>(rng() % hand.size());
+                    const std::uint32_t card = catalog.idOf(hand[index]->getName());
+                    game.playCard(player, index);
+                    if (player == opponent) sampler.reveal(card);
+                } else {
+                    game.pass(player);
+                }
+                game.update(0.f);
+            } catch (const std::exception&) {
+                if (game.isGameOver() || game.getCurrentPlayerIndex() != player) continue;
+                game.pass(player);
+                game.update(0.f);
+            }
+            checkSampler(sampler, game, opponent, catalog, name + " turn " + std::to_string(turn));
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::string deckFile = argc > 1 ? argv[1] : "assets/cards.json";
+    std::ifstream file(deckFile);
+    if (!file.is_open()) {
+        std::cerr << "Exception: Failed to open file: " << deckFile << std::endl;
+        return 1;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    CardCatalog catalog;
+    catalog.load(contents.str());
+
+    const std::pair<Faction, Faction> matchups[] = {
+        {Faction::NEUTRAL, Faction::NEUTRAL},
+        {Faction::MONSTERS, Faction::NORTH},
+        {Faction::NILFGARD, Faction::SCOIATAEL}
+    };
+    std::uint32_t seed = 1;
+    for (const auto& [first, second] : matchups) {
+        for (int i = 0; i < 30; ++i, ++seed) {
+            HandSampler sampler(catalog, seed);
+            playGame(contents.str(), catalog, first, second, seed, 500, sampler);
+        }
+    }
+
+    // Times sampling at a mid-game position.
+    HandSampler sampler(catalog, 1);
+    playGame(contents.str(), catalog, Faction::MONSTERS, Faction::NORTH, 7, 8, sampler);
+    std::uint64_t sink = 0;
+    for (std::size_t depth : {HandSampler::WHOLE_DECK, std::size_t(3)}) {
+        const int samples = 200000;
+        const auto started = std::chrono::steady_clock::now();
+        for (int n = 0; n < samples; ++n) {
+            const Determinization guess = sampler.sample(depth);
+            sink += guess.handSize + guess.deckSize;
+        }
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - started).count();
+        std::cerr << (depth == HandSampler::WHOLE_DECK ? "whole deck" : "top 3 of the deck") << ": "
+                  << samples / ms << " samples/ms\n";
+    }
+    if (sink == 0) std::cerr << "no cards were sampled\n";
+
+    return TestHarness::finish("All sampler checks passed");
+}
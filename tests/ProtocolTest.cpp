@@ -0,0 +1,345 @@
+#include "../include/Server/MatchDelta.h"
+#include "../include/Server/Protocol.h"
+#include "../include/Core/Game.h"
+#include "TestHarness.h"
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// gwent_protocol_test [cards.json]
+//
+// Round-trips every message and delta kind, feeds Protocol::decode random
+// and truncated bytes, and replays MatchShadow deltas against played games.
+namespace {
+    using Protocol::Delta;
+    using Protocol::DeltaKind;
+    using Protocol::DecodeStatus;
+    using Protocol::Message;
+    using Protocol::MessageType;
+    using TestHarness::check;
+
+    bool sameMessage(const Message& a, const Message& b) {
+        return a.type == b.type && a.matchId == b.matchId && a.player == b.player &&
+               a.index == b.index && a.text == b.text && a.deltas == b.deltas;
+    }
+
+    std::vector<Message> sampleMessages() {
+        std::vector<Message> messages;
+        Message message;
+
+        message.type = MessageType::NEW_MATCH;
+        message.text = "Alice Bob NORTH MONSTERS";
+        messages.push_back(message);
+
+        message.clear();
+        message.type = MessageType::PLAY;
+        message.matchId = 1234567890123ULL;
+        message.player = 1;
+        message.index = 9;
+        messages.push_back(message);
+
+        message.clear();
+        message.type = MessageType::PASS;
+        message.matchId = 7;
+        message.player = 1;
+        messages.push_back(message);
+
+        for (MessageType type : {MessageType::END_MATCH, MessageType::SPECTATE,
+                                 MessageType::JOIN_MATCH, MessageType::MATCH_CLOSED}) {
+            message.clear();
+            message.type = type;
+            message.matchId = ~0ULL;
+            messages.push_back(message);
+        }
+
+        message.clear();
+        message.type = MessageType::MATCH_STATE;
+        message.matchId = 42;
+        message.deltas = {
+            {DeltaKind::CARD_ADDED, 1, 2, 3, 140, -5},
+            {DeltaKind::CARD_REMOVED, 0, 1, 300},
+            {DeltaKind::POWER_CHANGED, 1, 0, 0, 0, 15},
+            {DeltaKind::WEATHER_SET, 0, 2, 0, 0, 3},
+            {DeltaKind::PASSED, 1},
+            {DeltaKind::ROUND_END, 2, 0, 0, 0, 3},
+            {DeltaKind::TURN, 0},
+            {DeltaKind::HAND_SIZE, 1, 0, 0, 0, 10},
+            {DeltaKind::GAME_OVER, 2},
+            {DeltaKind::HAND_CARD_ADDED, 0, 0, 4, 77},
+            {DeltaKind::HAND_CARD_REMOVED, 1, 0, 2}
+        };
+        messages.push_back(message);
+
+        message.clear();
+        message.type = MessageType::ERROR;
+        message.matchId = 3;
+        message.text = "Not your turn!";
+        messages.push_back(message);
+        return messages;
+    }
+
+    void testRoundTrip() {
+        const std::vector<Message> messages = sampleMessages();
+        std::string stream;
+        for (const auto& message : messages) {
+            std::string frame;
+            Protocol::encode(message, frame);
+            Message decoded;
+            std::size_t consumed = 0;
+            check(Protocol::decode(frame, decoded, consumed) == DecodeStatus::OK &&
+                  consumed == frame.size() && sameMessage(message, decoded),
+                  "round trip of message type " + std::to_string(static_cast<int>(message.type)));
+            stream += frame;
+        }
+
+        // Back to back frames decode one at a time.
+        std::size_t offset = 0;
+        for (const auto& message : messages) {
+            Message decoded;
+            std::size_t consumed = 0;
+            const auto status = Protocol::decode(std::string_view(stream).substr(offset), decoded, consumed);
+            check(status == DecodeStatus::OK && sameMessage(message, decoded), "decoding a stream of frames");
+            offset += consumed;
+        }
+        check(offset == stream.size(), "stream fully consumed");
+    }
+
+    void testTruncated() {
+        for (const auto& message : sampleMessages()) {
+            std::string frame;
+            Protocol::encode(message, frame);
+            for (std::size_t size = 0; size < frame.size(); ++size) {
+                Message decoded;
+                std::size_t consumed = 0;
+                check(Protocol::decode(std::string_view(frame).substr(0, size), decoded, consumed) ==
+                          DecodeStatus::INCOMPLETE,
+                      "prefix of " + std::to_string(size) + " bytes is incomplete");
+            }
+        }
+    }
+
+    // Whatever decode accepts must be exactly what encode produces for it.
+    void checkFuzzed(const std::string& bytes) {
+        Message decoded;
+        std::size_t consumed = 0;
+        if (Protocol::decode(bytes, decoded, consumed) != DecodeStatus::OK) return;
+        check(consumed <= bytes.size(), "decode consumed past the buffer");
+        std::string again;
+        Protocol::encode(decoded, again);
+        check(again == bytes.substr(0, consumed), "accepted frame is not canonical");
+    }
+
+    void testFuzz() {
+        std::mt19937 rng(2024);
+        std::vector<std::string> frames;
+        for (const auto& message : sampleMessages()) {
+            frames.emplace_back();
+            Protocol::encode(message, frames.back());
+        }
+
+        for (int i = 0; i < 200000; ++i) {
+            std::string bytes;
+            const std::size_t size = rng() % 48;
+            if (i % 2 == 0) {
+                // A valid header gets the payload past the first checks.
+                bytes.push_back(static_cast<char>(Protocol::MAGIC));
+                bytes.push_back(static_cast<char>(Protocol::VERSION));
+            }
+            while (bytes.size() < size) bytes.push_back(static_cast<char>(rng()));
+            checkFuzzed(bytes);
+        }
+
+        // Single byte changes to real frames.
+        for (int i = 0; i < 200000; ++i) {
+            std::string bytes = frames[rng() % frames.size()];
+            bytes[rng() % bytes.size()] = static_cast<char>(rng());
+            checkFuzzed(bytes);
+            checkFuzzed(bytes.substr(0, rng() % bytes.size()));
+        }
+    }
+
+    // A client's copy of a match, rebuilt only from deltas.
+    struct View {
+        struct Slot {
+            std::uint32_t card;
+            int power;
+        };
+
+        std::vector<Slot> rows[2][3];
+        std::vector<std::uint32_t> hand;
+        int weather[3] = {0, 0, 0};
+        int handSize[2] = {0, 0};
+        int currentPlayer = -1;
+        int round = 1;
+        bool gameOver = false;
+
+        bool apply(const Delta& delta) {
+            const int p = delta.player & 1;
+            auto& row = rows[p][delta.zone];
+            switch (delta.kind) {
+                case DeltaKind::CARD_ADDED:
+                    if (delta.slot > row.size()) return false;
+                    row.insert(row.begin() + delta.slot, {delta.card, delta.value});
+                    break;
+                case DeltaKind::CARD_REMOVED:
+                    if (delta.slot >= row.size()) return false;
+                    row.erase(row.begin() + delta.slot);
+                    break;
+                case DeltaKind::POWER_CHANGED:
+                    if (delta.slot >= row.size()) return false;
+                    row[delta.slot].power = delta.value;
+                    break;
+                case DeltaKind::WEATHER_SET:
+                    weather[delta.zone] = delta.value;
+                    break;
+                case DeltaKind::HAND_SIZE:
+                    handSize[p] = delta.value;
+                    break;
+                case DeltaKind::TURN:
+                    currentPlayer = delta.player;
+                    break;
+                case DeltaKind::ROUND_END:
+                    round = delta.value;
+                    break;
+                case DeltaKind::GAME_OVER:
+                    gameOver = true;
+                    break;
+                case DeltaKind::PASSED:
+                    break;
+                case DeltaKind::HAND_CARD_ADDED:
+                    if (delta.slot > hand.size()) return false;
+                    hand.insert(hand.begin() + delta.slot, delta.card);
+                    break;
+                case DeltaKind::HAND_CARD_REMOVED:
+                    if (delta.slot >= hand.size()) return false;
+                    hand.erase(hand.begin() + delta.slot);
+                    break;
+            }
+            return true;
+        }
+
+        bool matches(const Game& game, const CardCatalog& catalog, int seat) const {
+            const Board& board = game.getBoard();
+            for (int p = 0; p < 2; ++p) {
+                for (int z = 0; z < 3; ++z) {
+                    const auto& cards = board.getPlayerZone(p, static_cast<CombatZone>(z));
+                    if (cards.size() != rows[p][z].size()) return false;
+                    for (std::size_t i = 0; i < cards.size(); ++i) {
+                        if (rows[p][z][i].card != catalog.idOf(cards[i]->getName()) ||
+                            rows[p][z][i].power != cards[i]->getPower()) {
+                            return false;
+                        }
+                    }
+                }
+                if (handSize[p] != static_cast<int>(game.getPlayer(p).getHandSize())) return false;
+            }
+            for (int z = 0; z < 3; ++z) {
+                if (weather[z] != static_cast<int>(board.getWeatherType(static_cast<CombatZone>(z)))) return false;
+            }
+            if (seat != MatchShadow::NO_SEAT) {
+                const auto& cards = game.getPlayer(seat).getHand();
+                if (cards.size() != hand.size()) return false;
+                for (std::size_t i = 0; i < cards.size(); ++i) {
+                    if (hand[i] != catalog.idOf(cards[i]->getName())) return false;
+                }
+            } else if (!hand.empty()) {
+                return false;
+            }
+            return currentPlayer == game.getCurrentPlayerIndex() && round == game.getCurrentRound() &&
+                   gameOver == game.isGameOver();
+        }
+    };
+
+    // Sends a shadow's deltas through the wire format, as the server does.
+    bool replay(MatchShadow& shadow, View& view, const Game& game, const CardCatalog& catalog, int seat) {
+        Message message;
+        message.type = MessageType::MATCH_STATE;
+        shadow.diff(game, catalog, message.deltas);
+
+        std::string frame;
+        Protocol::encode(message, frame);
+        Message decoded;
+        std::size_t consumed = 0;
+        if (Protocol::decode(frame, decoded, consumed) != DecodeStatus::OK) return false;
+        for (const auto& delta : decoded.deltas) {
+            const bool handCard = delta.kind == DeltaKind::HAND_CARD_ADDED ||
+                                  delta.kind == DeltaKind::HAND_CARD_REMOVED;
+            // No view may learn about a hand that is not its own.
+            if (handCard && delta.player != seat) return false;
+            if (!view.apply(delta)) return false;
+        }
+        return true;
+    }
+
+    void testShadowReplay(const std::string& deckFile) {
+        std::ifstream file(deckFile);
+        if (!file.is_open()) {
+            check(false, "open " + deckFile);
+            return;
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        CardCatalog catalog;
+        catalog.load(contents.str());
+
+        for (std::uint32_t seed = 1; seed <= 100; ++seed) {
+            Game game("Alice", "Bob");
+            game.setOutput(nullptr);
+            std::istringstream deck(contents.str());
+            game.loadDeck(deck);
+            game.setSeed(seed);
+            game.startGame();
+
+            // Each seat is answered only after its own moves; the spectator
+            // view follows every move.
+            MatchShadow seats[2] = {MatchShadow(0), MatchShadow(1)};
+            MatchShadow spectator;
+            View seatViews[2];
+            View spectatorView;
+            std::mt19937 rng(seed);
+
+            const std::string name = "game " + std::to_string(seed);
+            for (int seat = 0; seat < 2; ++seat) {
+                check(replay(seats[seat], seatViews[seat], game, catalog, seat) &&
+                      seatViews[seat].matches(game, catalog, seat), name + ": seat opening state");
+            }
+
+            for (int turn = 0; turn < 500 && !game.isGameOver(); ++turn) {
+                const int player = game.getCurrentPlayerIndex();
+                const auto& hand = game.getPlayer(player).getHand();
+                try {
+                    if (!hand.empty() && rng() % 10 < 8) {
+                        game.playCard(player, static_cast<int>(rng() % hand.size()));
+                    } else {
+                        game.pass(player);
+                    }
+                    game.update(0.f);
+                } catch (const std::exception&) {
+                    if (game.isGameOver() || game.getCurrentPlayerIndex() != player) continue;
+                    game.pass(player);
+                    game.update(0.f);
+                }
+
+                check(replay(seats[player], seatViews[player], game, catalog, player) &&
+                      seatViews[player].matches(game, catalog, player),
+                      name + ": seat " + std::to_string(player) + " view after turn " + std::to_string(turn));
+                check(replay(spectator, spectatorView, game, catalog, MatchShadow::NO_SEAT) &&
+                      spectatorView.matches(game, catalog, MatchShadow::NO_SEAT),
+                      name + ": spectator view after turn " + std::to_string(turn));
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    const std::string deckFile = argc > 1 ? argv[1] : "assets/cards.json";
+
+    testRoundTrip();
+    testTruncated();
+    testFuzz();
+    testShadowReplay(deckFile);
+
+    return TestHarness::finish("All protocol checks passed");
+}
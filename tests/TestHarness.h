@@ -0,0 +1,30 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+// Checks shared by the test executables. A failed check is counted and the
+// first few are reported on stderr, so one broken invariant does not bury
+// the rest of the output.
+namespace TestHarness {
+    constexpr int REPORTED_FAILURES = 20;
+
+    inline int failures = 0;
+
+    inline void check(bool condition, const std::string& what) {
+        if (!condition) {
+            ++failures;
+            if (failures <= REPORTED_FAILURES) std::cerr << "FAILED: " << what << "\n";
+        }
+    }
+
+    // Reports the outcome and returns the exit code for main.
+    inline int finish(const std::string& passed) {
+        if (failures > 0) {
+            std::cerr << failures << " checks failed\n";
+            return 1;
+        }
+        std::cerr << passed << "\n";
+        return 0;
+    }
+}